@@ -0,0 +1,36 @@
+#include <cstdlib>
+
+#include "Arena.hh"
+#include "xmalloc.h"
+
+using namespace std;
+
+Arena::Arena(size_t firstChunk) :
+    mChunkSize(firstChunk),
+    mNext(0),
+    mEnd(0)
+{
+}
+
+Arena::~Arena()
+{
+    for (vector<char *>::iterator i = mChunks.begin(); i != mChunks.end(); i++)
+        free(*i);
+}
+
+void *Arena::allocate(size_t size)
+{
+    size = (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if ((size_t)(mEnd - mNext) < size) {
+        while (mChunkSize < size)
+            mChunkSize *= 2;
+        mNext = static_cast<char *>(xmalloc(mChunkSize));
+        mEnd = mNext + mChunkSize;
+        mChunks.push_back(mNext);
+        mChunkSize *= 2;
+    }
+
+    void *result = mNext;
+    mNext += size;
+    return result;
+}
@@ -0,0 +1,31 @@
+#ifndef ARENA_HH__
+#define ARENA_HH__
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Bump allocator for many small objects that all die together. Memory comes
+ * from chunks that double in size as they fill, and is only given back, all
+ * at once, when the arena is destroyed; destructors are never run, so only
+ * objects that own nothing else belong here.
+ */
+class Arena
+{
+public:
+    Arena(size_t firstChunk = FIRST_CHUNK);
+    ~Arena();
+
+    void *allocate(size_t size);
+
+private:
+    static const size_t FIRST_CHUNK = 64 * 1024;
+    static const size_t ALIGNMENT = 16;
+
+    std::vector<char *> mChunks;
+    size_t mChunkSize;
+    char *mNext;
+    char *mEnd;
+};
+
+#endif
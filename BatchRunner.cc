@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <assert.h>
+#include <err.h>
+#include <stdint.h>
+
+#include "BatchRunner.hh"
+
+using namespace std;
+
+extern "C"
+{
+struct BatchWorkerArgs
+{
+    BatchRunner *runner;
+    int thread;
+};
+static void *BatchWorker(void *p)
+{
+    BatchWorkerArgs *args = (BatchWorkerArgs *)p;
+    args->runner->work(args->thread);
+    return 0;
+}
+}
+
+BatchRunner::BatchRunner(CompiledFunction &function, int threads) :
+    mFunction(function),
+    mThreads(threads),
+    mParams(0),
+    mResults(0),
+    mHalted(0)
+{
+}
+
+// Makes the given number of calls, each on the next arity-sized group of
+// params, putting the results in the same order, along with whether each
+// call halted
+void BatchRunner::run(vector<unsigned int> &params,
+                      unsigned int calls,
+                      vector<int> &results,
+                      vector<char> &halted)
+{
+    assert(params.size() == (size_t)calls * mFunction.getArity());
+    results.resize(calls);
+    halted.resize(calls);
+    mParams = &params;
+    mResults = &results;
+    mHalted = &halted;
+
+    int threads = max(1, min(mThreads, (int)calls));
+    mShares.clear();
+    mShares.resize(threads);
+    for (int i = 0; i < threads; i++) {
+        mShares[i].next = (uint64_t)calls * i / threads;
+        mShares[i].end = (uint64_t)calls * (i + 1) / threads;
+    }
+
+    vector<pthread_t> workers(threads - 1);
+    vector<BatchWorkerArgs> args(threads - 1);
+    for (unsigned int i = 0; i < workers.size(); i++) {
+        args[i].runner = this;
+        args[i].thread = i + 1;
+        if (pthread_create(&workers[i], 0, BatchWorker, &args[i]))
+            errx(1, "Unable to start batch thread");
+    }
+    work(0);
+    for (unsigned int i = 0; i < workers.size(); i++)
+        pthread_join(workers[i], 0);
+}
+
+void BatchRunner::work(int thread)
+{
+    int arity = mFunction.getArity();
+    unsigned int call;
+    while (take(thread, &call) || (steal(thread) && take(thread, &call))) {
+        unsigned int *params = arity ? &(*mParams)[call * arity] : 0;
+        (*mHalted)[call] = mFunction.call(params, &(*mResults)[call]);
+    }
+}
+
+bool BatchRunner::take(int thread, unsigned int *call)
+{
+    Share &share = mShares[thread];
+    pthread_mutex_lock(&share.lock);
+    bool found = share.next < share.end;
+    if (found)
+        *call = share.next++;
+    pthread_mutex_unlock(&share.lock);
+    return found;
+}
+
+// Moves the back half of the biggest other share into this thread's. The
+// sizes are only a guess until the victim is locked, so we may come away
+// with nothing even though there is work left; then we look again.
+bool BatchRunner::steal(int thread)
+{
+    for (;;) {
+        int victim = -1;
+        unsigned int most = 0;
+        for (unsigned int i = 0; i < mShares.size(); i++) {
+            unsigned int next = __atomic_load_n(&mShares[i].next,
+                                                __ATOMIC_RELAXED);
+            unsigned int end = __atomic_load_n(&mShares[i].end,
+                                               __ATOMIC_RELAXED);
+            if ((int)i != thread && next < end && end - next > most) {
+                victim = i;
+                most = end - next;
+            }
+        }
+        if (victim < 0)
+            return false;
+
+        Share &from = mShares[victim];
+        pthread_mutex_lock(&from.lock);
+        unsigned int begin = from.next + (from.end - from.next) / 2;
+        unsigned int end = from.end;
+        from.end = begin;
+        pthread_mutex_unlock(&from.lock);
+        if (begin == end)
+            continue;
+
+        Share &to = mShares[thread];
+        pthread_mutex_lock(&to.lock);
+        to.next = begin;
+        to.end = end;
+        pthread_mutex_unlock(&to.lock);
+        return true;
+    }
+}
+
+BatchRunner::Share::Share() :
+    next(0),
+    end(0)
+{
+    pthread_mutex_init(&lock, 0);
+}
+
+BatchRunner::Share::Share(const Share &other) :
+    next(other.next),
+    end(other.end)
+{
+    pthread_mutex_init(&lock, 0);
+}
+
+BatchRunner::Share::~Share()
+{
+    pthread_mutex_destroy(&lock);
+}
@@ -0,0 +1,53 @@
+#ifndef BATCHRUNNER_HH__
+#define BATCHRUNNER_HH__
+
+#include <pthread.h>
+#include <vector>
+
+#include "CompiledFunction.hh"
+
+/*
+ * Calls one compiled function on many parameter sets across threads, all
+ * sharing its code. Each thread starts with an even share of the sets and
+ * works through it from the front; once done it steals the back half of
+ * whichever share has most left, so long runs don't hold everyone up.
+ */
+class BatchRunner
+{
+public:
+    class Share;
+
+    BatchRunner(CompiledFunction &function, int threads);
+
+    void run(std::vector<unsigned int> &params,
+             unsigned int calls,
+             std::vector<int> &results,
+             std::vector<char> &halted);
+    void work(int thread);
+
+private:
+    CompiledFunction &mFunction;
+    int mThreads;
+    std::vector<unsigned int> *mParams;
+    std::vector<int> *mResults;
+    std::vector<char> *mHalted;
+    std::vector<Share> mShares;
+
+    bool take(int thread, unsigned int *call);
+    bool steal(int thread);
+};
+
+// The calls [next, end) left to one thread
+class BatchRunner::Share
+{
+public:
+    Share();
+    Share(const Share &other);
+    ~Share();
+
+    pthread_mutex_t lock;
+    unsigned int next;
+    unsigned int end;
+};
+
+#endif
@@ -0,0 +1,221 @@
+#include <cstdio>
+#include <cstring>
+#include <err.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CodeCache.hh"
+
+using namespace std;
+
+static bool writeAll(int fd, const void *data, size_t size)
+{
+    const char *p = (const char *)data;
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+        if (written <= 0)
+            return false;
+        p += written;
+        size -= written;
+    }
+    return true;
+}
+
+CodeCache::CodeCache(const string &directory, uint64_t key) :
+    mKey(key),
+    mCode(0),
+    mCodeSize(0),
+    mMapping(0),
+    mMappingSize(0)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/%016llx.tjc", (unsigned long long)key);
+    mPath = directory + name;
+}
+
+CodeCache::~CodeCache()
+{
+    if (mMapping)
+        munmap(mMapping, mMappingSize);
+}
+
+// FNV-1a
+uint64_t CodeCache::hash(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Identifies the running executable, so that images from other builds,
+// whose code generation may differ, are never used
+uint64_t CodeCache::getBuildKey()
+{
+    struct stat st;
+    uint64_t key = HASH_BASIS;
+    if (stat("/proc/self/exe", &st) == 0) {
+        key = hash(key, &st.st_ino, sizeof(st.st_ino));
+        key = hash(key, &st.st_size, sizeof(st.st_size));
+        key = hash(key, &st.st_mtime, sizeof(st.st_mtime));
+    }
+    return key;
+}
+
+// Maps the image in, if there is a usable one
+bool CodeCache::load(int stateCount)
+{
+    int fd = open(mPath.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) || (size_t)st.st_size < sizeof(Header)) {
+        close(fd);
+        return false;
+    }
+    mMappingSize = st.st_size;
+    mMapping = mmap(0, mMappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mMapping == MAP_FAILED) {
+        mMapping = 0;
+        return false;
+    }
+
+    // Bound each count by what is left of the file before using it, so no
+    // sum of them can wrap around
+    const Header *header = (const Header *)mMapping;
+    size_t left = mMappingSize - sizeof(Header);
+    size_t tables = stateCount * (sizeof(int) + sizeof(unsigned int));
+    if (header->magic != MAGIC ||
+        header->key != mKey ||
+        header->stateCount != (uint32_t)stateCount ||
+        tables > left ||
+        header->relocationCount >
+            (left - tables) / sizeof(MASM::Relocation) ||
+        header->codeSize != left - tables -
+            header->relocationCount * sizeof(MASM::Relocation) ||
+        header->checksum != hash(HASH_BASIS, header + 1, left))
+    {
+        warnx("Ignoring damaged code cache '%s'", mPath.c_str());
+        return false;
+    }
+
+    const char *p = (const char *)(header + 1);
+    const int *stateOffsets = (const int *)p;
+    mStateOffsets.assign(stateOffsets, stateOffsets + stateCount);
+    p += stateCount * sizeof(int);
+    const unsigned int *bodyOffsets = (const unsigned int *)p;
+    mBodyOffsets.assign(bodyOffsets, bodyOffsets + stateCount);
+    p += stateCount * sizeof(unsigned int);
+    const MASM::Relocation *relocations = (const MASM::Relocation *)p;
+    mRelocations.assign(relocations, relocations + header->relocationCount);
+    p += header->relocationCount * sizeof(MASM::Relocation);
+    mCode = p;
+    mCodeSize = header->codeSize;
+
+    // Both a state's code and the body superblocks jump back into must lie
+    // in the image
+    for (int i = 0; i < stateCount; i++) {
+        if (mStateOffsets[i] == -1)
+            continue;
+        if (mStateOffsets[i] < 0 ||
+            (uint64_t)mStateOffsets[i] + mBodyOffsets[i] >= mCodeSize)
+        {
+            warnx("Ignoring damaged code cache '%s'", mPath.c_str());
+            return false;
+        }
+    }
+    for (vector<MASM::Relocation>::iterator i = mRelocations.begin();
+         i != mRelocations.end();
+         i++)
+    {
+        if (i->getOffset() + sizeof(uint64_t) > mCodeSize) {
+            warnx("Ignoring damaged code cache '%s'", mPath.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// Failing to save only costs the next run a compile, so just warn
+void CodeCache::save()
+{
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%d", (int)getpid());
+    string temp = mPath + suffix;
+
+    int fd = open(temp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        warn("Unable to write code cache '%s'", temp.c_str());
+        return;
+    }
+
+    Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.key = mKey;
+    header.stateCount = mStateOffsets.size();
+    header.relocationCount = mRelocations.size();
+    header.codeSize = mCodeSize;
+    header.checksum = hash(HASH_BASIS, &mStateOffsets[0],
+                           mStateOffsets.size() * sizeof(int));
+    header.checksum = hash(header.checksum, &mBodyOffsets[0],
+                           mBodyOffsets.size() * sizeof(unsigned int));
+    if (!mRelocations.empty()) {
+        header.checksum = hash(header.checksum, &mRelocations[0],
+                               mRelocations.size() * sizeof(MASM::Relocation));
+    }
+    header.checksum = hash(header.checksum, mCode, mCodeSize);
+
+    bool ok = writeAll(fd, &header, sizeof(header)) &&
+        writeAll(fd, &mStateOffsets[0], mStateOffsets.size() * sizeof(int)) &&
+        writeAll(fd, &mBodyOffsets[0],
+                 mBodyOffsets.size() * sizeof(unsigned int)) &&
+        (mRelocations.empty() ||
+         writeAll(fd, &mRelocations[0],
+                  mRelocations.size() * sizeof(MASM::Relocation))) &&
+        writeAll(fd, mCode, mCodeSize);
+    if (close(fd))
+        ok = false;
+
+    if (!ok || rename(temp.c_str(), mPath.c_str())) {
+        warn("Unable to write code cache '%s'", mPath.c_str());
+        unlink(temp.c_str());
+    }
+}
+
+vector<int> &CodeCache::getStateOffsets()
+{
+    return mStateOffsets;
+}
+
+vector<unsigned int> &CodeCache::getBodyOffsets()
+{
+    return mBodyOffsets;
+}
+
+vector<MASM::Relocation> &CodeCache::getRelocations()
+{
+    return mRelocations;
+}
+
+const void *CodeCache::getCode()
+{
+    return mCode;
+}
+
+size_t CodeCache::getCodeSize()
+{
+    return mCodeSize;
+}
+
+void CodeCache::setCode(const void *code, size_t size)
+{
+    mCode = code;
+    mCodeSize = size;
+}
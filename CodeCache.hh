@@ -0,0 +1,69 @@
+#ifndef CODECACHE_HH__
+#define CODECACHE_HH__
+
+#include <cstddef>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "MASM.hh"
+
+/*
+ * Compiled code for a whole machine, kept in a file between runs and named
+ * by a key hashing everything that went into generating it. The image is
+ * the code of the compiled states back to back with the transitions
+ * between them linked, so it works anywhere once every absolute address
+ * named by its relocations has been rewritten. Images are written under a
+ * temporary name and renamed into place, so no run sees one half-written,
+ * and carry a checksum so that one damaged since is compiled afresh.
+ */
+class CodeCache
+{
+public:
+    CodeCache(const std::string &directory, uint64_t key);
+    ~CodeCache();
+
+    static uint64_t hash(uint64_t hash, const void *data, size_t size);
+    static uint64_t getBuildKey();
+
+    bool load(int stateCount);
+    void save();
+
+    // Offset of each state's code in the image, or -1 if it has none
+    std::vector<int> &getStateOffsets();
+    std::vector<unsigned int> &getBodyOffsets();
+    std::vector<MASM::Relocation> &getRelocations();
+    const void *getCode();
+    size_t getCodeSize();
+    void setCode(const void *code, size_t size);
+
+private:
+    class Header;
+
+    static const uint64_t MAGIC = 0x45444f4354494a54ull;
+    static const uint64_t HASH_BASIS = 0xcbf29ce484222325ull;
+
+    std::string mPath;
+    uint64_t mKey;
+    std::vector<int> mStateOffsets;
+    std::vector<unsigned int> mBodyOffsets;
+    std::vector<MASM::Relocation> mRelocations;
+    const void *mCode;
+    size_t mCodeSize;
+    void *mMapping;
+    size_t mMappingSize;
+};
+
+class CodeCache::Header
+{
+public:
+    uint64_t magic;
+    uint64_t key;
+    uint32_t stateCount;
+    uint32_t relocationCount;
+    uint64_t codeSize;
+    // Hash of everything after the header
+    uint64_t checksum;
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include <algorithm>
+
+#include "CompiledFunction.hh"
+#include "Execution.hh"
+
+using namespace std;
+
+static int log2(unsigned int x)
+{
+    int result = 0;
+    while ((x >>= 1))
+        result++;
+    return result;
+}
+
+CompiledFunction::CompiledFunction(Function *function,
+                                   const JIT::Options &options) :
+    mFunction(function),
+    mStepLimit(options.stepLimit),
+    mJIT(function, options)
+{
+}
+
+int CompiledFunction::getArity()
+{
+    return mFunction->getArity();
+}
+
+size_t CompiledFunction::getCodeSize()
+{
+    return mJIT.getCodeSize();
+}
+
+// Returns false if the call didn't halt within the step limit
+bool CompiledFunction::call(unsigned int *params, int *result)
+{
+    Execution *execution = start(params);
+    resume(execution, UINT64_MAX);
+    return finish(execution, result);
+}
+
+Execution *CompiledFunction::start(unsigned int *params)
+{
+    int arity = mFunction->getArity();
+
+    // Figure out initial tape length
+    // Note that this includes two hashes on the front and back of the value
+    int maxParam = 2;
+    for (int i = 0; i < arity; i++)
+        maxParam = max(maxParam, log2(params[i]) + 1 + 2);
+
+    Execution *execution = new Execution(mJIT.createTape(maxParam));
+    Tape *tape = execution->tape;
+    for (int i = 0; i < arity; i++) {
+        tape->getCell(0)[i] = 2; // Hash
+        int j;
+        unsigned int parami = params[i];
+        for (j = 1; parami != 0; j++) {
+            tape->getCell(j)[i] = parami % 2;
+            parami >>= 1;
+        }
+        tape->getCell(j)[i] = 2; // Hash
+    }
+
+    mJIT.start(*execution);
+    return execution;
+}
+
+// Runs the call for up to fuel more state entries, returning true once
+// it's over: halted, or out of steps
+bool CompiledFunction::resume(Execution *execution, uint64_t fuel)
+{
+    if (mStepLimit)
+        fuel = min(fuel, mStepLimit - min(mStepLimit, execution->steps));
+    execution->fuel = fuel;
+    return mJIT.resume(*execution) ||
+           (mStepLimit && execution->steps >= mStepLimit);
+}
+
+// Takes the result of a call that's over and frees it, returning false if
+// it never halted
+bool CompiledFunction::finish(Execution *execution, int *result)
+{
+    int arity = mFunction->getArity();
+    int tapeCount = mJIT.getTapeCount();
+    bool halted = mJIT.isHalted(*execution);
+
+    // Extract our result
+    if (halted) {
+        unsigned char *tapePtr = execution->head;
+        *result = 0;
+        int multiplier = 1;
+        for (int j = 0; tapePtr[tapeCount * j + arity] != 2; j++) {
+            *result = *result + multiplier * tapePtr[tapeCount * j + arity];
+            multiplier *= 2;
+        }
+    }
+
+    delete execution;
+    return halted;
+}
+
+void CompiledFunction::writeStats(FILE *out, bool json)
+{
+    mJIT.writeStats(out, json);
+}
+
+void CompiledFunction::writeProfile(const string &path)
+{
+    mJIT.writeProfile(path);
+}
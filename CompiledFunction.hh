@@ -0,0 +1,41 @@
+#ifndef COMPILEDFUNCTION_HH__
+#define COMPILEDFUNCTION_HH__
+
+#include <cstdio>
+#include <stdint.h>
+#include <string>
+
+#include "Execution.hh"
+#include "Function.hh"
+#include "JIT.hh"
+
+/*
+ * A function ready to be called with any number of parameter sets. Code
+ * compiled for one call is kept for the rest, and each call gets a fresh
+ * tape holding its parameters in binary between hashes. A call may also be
+ * run a slice of fuel at a time: start() it, resume() it until that says
+ * it's over, then finish() it. Calls past the step limit are cut short.
+ */
+class CompiledFunction
+{
+public:
+    CompiledFunction(Function *function, const JIT::Options &options);
+
+    int getArity();
+    size_t getCodeSize();
+    bool call(unsigned int *params, int *result);
+
+    Execution *start(unsigned int *params);
+    bool resume(Execution *execution, uint64_t fuel);
+    bool finish(Execution *execution, int *result);
+
+    void writeStats(FILE *out, bool json);
+    void writeProfile(const std::string &path);
+
+private:
+    Function *mFunction;
+    uint64_t mStepLimit;
+    JIT mJIT;
+};
+
+#endif
@@ -0,0 +1,271 @@
+#include <algorithm>
+
+#include "DecisionTree.hh"
+#include "WideAccess.hh"
+
+using namespace std;
+
+/*
+ * A node is identified by the rules that can still match, in order, and the
+ * tapes whose cells have already been examined on the way to it. Targets are
+ * either node indices, TARGET_FAIL, or -2 - i for the action of rule i.
+ */
+
+DecisionTree::DecisionTree(vector<Rule *> &rules, int tapeOffset) :
+    mRules(rules),
+    mTapeOffset(tapeOffset)
+{
+    for (vector<Rule *>::iterator i = rules.begin(); i != rules.end(); i++) {
+        map<int, int> condition;
+        Pattern *patterns = (*i)->getCondition();
+        for (unsigned int j = 0; j < (*i)->getConditionSize(); j++) {
+            Pattern *pat = &patterns[j];
+            map<int, int>::iterator existing = condition.find(pat->getTape());
+            if (existing != condition.end() &&
+                existing->second != pat->getSymbol())
+                existing->second = -1; // Can never match
+            else
+                condition[pat->getTape()] = pat->getSymbol();
+        }
+        mConditions.push_back(condition);
+    }
+}
+
+DecisionTree::~DecisionTree()
+{
+    for (vector<Node *>::iterator i = mNodes.begin(); i != mNodes.end(); i++)
+        delete *i;
+}
+
+void DecisionTree::emit(MASM &masm,
+                        vector<vector<MASM::Jump> > &actionJumps,
+                        vector<MASM::Jump> &failJumps)
+{
+    vector<int> candidates;
+    vector<int> decided;
+    for (unsigned int i = 0; i < mRules.size(); i++) {
+        bool possible = true;
+        for (map<int, int>::iterator j = mConditions[i].begin();
+             j != mConditions[i].end();
+             j++)
+        {
+            if (j->second < 0)
+                possible = false;
+        }
+        if (possible)
+            candidates.push_back(i);
+    }
+
+    int target = resolve(candidates, decided);
+    if (target < 0) {
+        jumpTo(masm, target, masm.jump32(), actionJumps, failJumps);
+        return;
+    }
+
+    // Emit nodes until none are left, letting each node fall through into
+    // its default case where we can.
+    int next = target;
+    for (;;) {
+        if (next < 0) {
+            while (!mWorklist.empty() && mNodes[mWorklist.back()]->emitted)
+                mWorklist.pop_back();
+            if (mWorklist.empty())
+                break;
+            next = mWorklist.back();
+            mWorklist.pop_back();
+        }
+        next = emitNode(masm, next, actionJumps, failJumps);
+    }
+}
+
+int DecisionTree::resolve(vector<int> &candidates, vector<int> &decided)
+{
+    if (candidates.empty())
+        return TARGET_FAIL;
+
+    // The first candidate wins once nothing about it is left to check
+    int first = candidates[0];
+    bool complete = true;
+    for (map<int, int>::iterator i = mConditions[first].begin();
+         i != mConditions[first].end();
+         i++)
+    {
+        if (!binary_search(decided.begin(), decided.end(), i->first))
+            complete = false;
+    }
+    if (complete)
+        return -2 - first;
+
+    vector<int> key(candidates);
+    key.push_back(-1);
+    key.insert(key.end(), decided.begin(), decided.end());
+
+    map<vector<int>, int>::iterator existing = mNodeIndex.find(key);
+    if (existing != mNodeIndex.end())
+        return existing->second;
+
+    int index = mNodes.size();
+    mNodes.push_back(new Node(candidates, decided));
+    mNodeIndex[key] = index;
+    mWorklist.push_back(index);
+    return index;
+}
+
+// Branch on one of the cells the first candidate still needs, preferring
+// the one that the most other candidates also look at.
+int DecisionTree::chooseTape(Node *node)
+{
+    int best = -1;
+    int bestCount = -1;
+    map<int, int> &first = mConditions[node->candidates[0]];
+    for (map<int, int>::iterator i = first.begin(); i != first.end(); i++) {
+        if (binary_search(node->decided.begin(), node->decided.end(), i->first))
+            continue;
+
+        int count = 0;
+        for (vector<int>::iterator j = node->candidates.begin();
+             j != node->candidates.end();
+             j++)
+        {
+            if (mConditions[*j].count(i->first))
+                count++;
+        }
+        if (count > bestCount) {
+            best = i->first;
+            bestCount = count;
+        }
+    }
+    return best;
+}
+
+int DecisionTree::emitNode(MASM &masm,
+                           int index,
+                           vector<vector<MASM::Jump> > &actionJumps,
+                           vector<MASM::Jump> &failJumps)
+{
+    Node *node = mNodes[index];
+    node->emitted = true;
+    node->offset = masm.label().getOffset();
+    for (vector<MASM::Jump>::iterator i = node->jumps.begin();
+         i != node->jumps.end();
+         i++)
+    {
+        masm.link(*i, masm.label());
+    }
+
+    int tape = chooseTape(node);
+    vector<int> decided(node->decided);
+    decided.insert(upper_bound(decided.begin(), decided.end(), tape), tape);
+
+    // Work out where each symbol on this tape takes us
+    map<int, int> children;
+    vector<int> defaultCandidates;
+    for (vector<int>::iterator i = node->candidates.begin();
+         i != node->candidates.end();
+         i++)
+    {
+        map<int, int>::iterator cond = mConditions[*i].find(tape);
+        if (cond != mConditions[*i].end())
+            children[cond->second] = 0;
+        else
+            defaultCandidates.push_back(*i);
+    }
+    for (map<int, int>::iterator i = children.begin(); i != children.end(); i++) {
+        vector<int> candidates;
+        for (vector<int>::iterator j = node->candidates.begin();
+             j != node->candidates.end();
+             j++)
+        {
+            map<int, int>::iterator cond = mConditions[*j].find(tape);
+            if (cond == mConditions[*j].end() || cond->second == i->first)
+                candidates.push_back(*j);
+        }
+        i->second = resolve(candidates, decided);
+    }
+    int defaultChild = resolve(defaultCandidates, decided);
+
+    // If this cell only separates one symbol from everything else, then
+    // branching on it is no better than testing rules in turn, so test all
+    // of the first candidate's remaining cells at once instead.
+    map<int, int> remaining;
+    int first = node->candidates[0];
+    for (map<int, int>::iterator i = mConditions[first].begin();
+         i != mConditions[first].end();
+         i++)
+    {
+        if (!binary_search(node->decided.begin(), node->decided.end(), i->first))
+            remaining.insert(*i);
+    }
+    if (children.size() == 1 && remaining.size() > 1) {
+        vector<MASM::Jump> fail;
+        WideAccess::emitCompare(masm, remaining, mTapeOffset, fail);
+        jumpTo(masm, -2 - first, masm.jump32(), actionJumps, failJumps);
+
+        vector<int> rest(node->candidates.begin() + 1, node->candidates.end());
+        int target = resolve(rest, node->decided);
+        for (vector<MASM::Jump>::iterator i = fail.begin(); i != fail.end(); i++)
+            jumpTo(masm, target, *i, actionJumps, failJumps);
+        return -1;
+    }
+
+    masm.load8ZeroExtend(MASM::RAX,
+                         MASM::Location(MASM::RBX, 0, 0, mTapeOffset + tape));
+
+    int low = children.begin()->first;
+    int range = children.rbegin()->first - low + 1;
+    if ((int)children.size() >= MIN_TABLE_VALUES &&
+        range <= (int)children.size() * MAX_TABLE_SPARSENESS) {
+        // Dense enough for a table of jumps, five bytes per entry
+        masm.add32(MASM::RAX, -low);
+        masm.compare32(MASM::RAX, range);
+        jumpTo(masm, defaultChild, masm.jump32(MASM::COND_NOT_BELOW),
+               actionJumps, failJumps);
+        MASM::Jump table = masm.loadAddress(MASM::RDX);
+        masm.loadAddress(MASM::RAX, MASM::Location(MASM::RAX, MASM::RAX, 4));
+        masm.add64(MASM::RAX, MASM::RDX);
+        masm.jumpIndirect(MASM::RAX);
+        masm.link(table, masm.label());
+        for (int value = low; value < low + range; value++) {
+            map<int, int>::iterator child = children.find(value);
+            int target = child != children.end() ? child->second : defaultChild;
+            jumpTo(masm, target, masm.jump32(), actionJumps, failJumps);
+        }
+        return -1;
+    }
+
+    for (map<int, int>::iterator i = children.begin(); i != children.end(); i++) {
+        masm.compare32(MASM::RAX, i->first);
+        jumpTo(masm, i->second, masm.jump32(MASM::COND_EQUAL),
+               actionJumps, failJumps);
+    }
+
+    if (defaultChild >= 0 && !mNodes[defaultChild]->emitted)
+        return defaultChild;
+    jumpTo(masm, defaultChild, masm.jump32(), actionJumps, failJumps);
+    return -1;
+}
+
+void DecisionTree::jumpTo(MASM &masm,
+                          int target,
+                          MASM::Jump jump,
+                          vector<vector<MASM::Jump> > &actionJumps,
+                          vector<MASM::Jump> &failJumps)
+{
+    if (target == TARGET_FAIL) {
+        failJumps.push_back(jump);
+    } else if (target < 0) {
+        actionJumps[-2 - target].push_back(jump);
+    } else if (mNodes[target]->emitted) {
+        masm.link(jump, MASM::Label(mNodes[target]->offset));
+    } else {
+        mNodes[target]->jumps.push_back(jump);
+    }
+}
+
+DecisionTree::Node::Node(vector<int> &candidates, vector<int> &decided) :
+    candidates(candidates),
+    decided(decided),
+    emitted(false),
+    offset(0)
+{
+}
@@ -0,0 +1,68 @@
+#ifndef DECISIONTREE_HH__
+#define DECISIONTREE_HH__
+
+#include <map>
+#include <vector>
+
+#include "MASM.hh"
+#include "Rule.hh"
+
+/*
+ * Dispatch code for the rules of one state. Rather than testing each rule in
+ * turn, we branch on one tape cell at a time, so every cell is read at most
+ * once on any path through the tree. Rules are given in priority order,
+ * usually most specific first, and the first rule whose conditions all hold
+ * is the one selected.
+ */
+class DecisionTree
+{
+public:
+    DecisionTree(std::vector<Rule *> &rules, int tapeOffset = 0);
+    ~DecisionTree();
+
+    // Jumps to the action of rule i are appended to actionJumps[i]; jumps
+    // taken when no rule matches are appended to failJumps.
+    void emit(MASM &masm,
+              std::vector<std::vector<MASM::Jump> > &actionJumps,
+              std::vector<MASM::Jump> &failJumps);
+
+private:
+    class Node;
+
+    static const int TARGET_FAIL = -1;
+    static const int MIN_TABLE_VALUES = 4;
+    static const int MAX_TABLE_SPARSENESS = 2;
+
+    std::vector<Rule *> &mRules;
+    int mTapeOffset;
+    std::vector<std::map<int, int> > mConditions;
+    std::vector<Node *> mNodes;
+    std::map<std::vector<int>, int> mNodeIndex;
+    std::vector<int> mWorklist;
+
+    int resolve(std::vector<int> &candidates, std::vector<int> &decided);
+    int chooseTape(Node *node);
+    int emitNode(MASM &masm,
+                 int index,
+                 std::vector<std::vector<MASM::Jump> > &actionJumps,
+                 std::vector<MASM::Jump> &failJumps);
+    void jumpTo(MASM &masm,
+                int target,
+                MASM::Jump jump,
+                std::vector<std::vector<MASM::Jump> > &actionJumps,
+                std::vector<MASM::Jump> &failJumps);
+};
+
+class DecisionTree::Node
+{
+public:
+    Node(std::vector<int> &candidates, std::vector<int> &decided);
+
+    std::vector<int> candidates;
+    std::vector<int> decided;
+    std::vector<MASM::Jump> jumps;
+    bool emitted;
+    unsigned int offset;
+};
+
+#endif
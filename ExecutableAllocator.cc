@@ -0,0 +1,94 @@
+#include <err.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "ExecutableAllocator.hh"
+
+ExecutableAllocator::ExecutableAllocator(size_t reserveSize) :
+    mReserved(reserveSize),
+    mCommitted(0),
+    mUsed(0)
+{
+    // Both mappings cover the whole reservation; only the part of the file
+    // that has been committed is backed
+    mFile = memfd_create("tjit-code", MFD_CLOEXEC);
+    if (mFile < 0)
+        err(1, "Unable to create JIT code file");
+
+    void *result = mmap(0,
+                        mReserved,
+                        PROT_READ | PROT_EXEC,
+                        MAP_SHARED | MAP_NORESERVE,
+                        mFile,
+                        0);
+    if (result == MAP_FAILED)
+        err(1, "Unable to reserve JIT code space");
+    mBase = (char *)result;
+
+    result = mmap(0,
+                  mReserved,
+                  PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_NORESERVE,
+                  mFile,
+                  0);
+    if (result == MAP_FAILED)
+        err(1, "Unable to reserve JIT code space");
+    mWritableBase = (char *)result;
+}
+
+ExecutableAllocator::~ExecutableAllocator()
+{
+    munmap(mBase, mReserved);
+    munmap(mWritableBase, mReserved);
+    close(mFile);
+}
+
+// Returns the start of the free space, with at least minSize bytes of it
+// committed. The caller may use up to *available bytes and must then call
+// commit() with the number of bytes it actually used.
+void *ExecutableAllocator::getBuffer(size_t minSize, size_t *available)
+{
+    if (mCommitted - mUsed < minSize) {
+        size_t target = mUsed + minSize;
+        target = (target + COMMIT_GRANULE - 1) / COMMIT_GRANULE * COMMIT_GRANULE;
+        if (target > mReserved)
+            errx(1, "JIT code space exhausted");
+
+        if (ftruncate(mFile, target))
+            err(1, "Unable to grow JIT code space");
+        mCommitted = target;
+    }
+
+    *available = mCommitted - mUsed;
+    return mBase + mUsed;
+}
+
+void *ExecutableAllocator::commit(size_t used)
+{
+    char *result = mBase + mUsed;
+    mUsed += (used + CODE_ALIGNMENT - 1) / CODE_ALIGNMENT * CODE_ALIGNMENT;
+    if (mUsed > mCommitted)
+        mUsed = mCommitted;
+    return result;
+}
+
+// The writable view of an address in the code
+void *ExecutableAllocator::getWritable(void *address)
+{
+    return (char *)address + getWriteOffset();
+}
+
+ptrdiff_t ExecutableAllocator::getWriteOffset()
+{
+    return mWritableBase - mBase;
+}
+
+size_t ExecutableAllocator::getSize()
+{
+    return mUsed;
+}
+
+bool ExecutableAllocator::contains(void *address)
+{
+    return address >= mBase && address < mBase + mUsed;
+}
@@ -0,0 +1,44 @@
+#ifndef EXECUTABLEALLOCATOR_HH__
+#define EXECUTABLEALLOCATOR_HH__
+
+#include <cstddef>
+
+/*
+ * Bump allocator for generated code. A single large range of address space
+ * is reserved up front and committed in chunks as it fills, so all code is
+ * packed densely and stays within rel32 range of itself. The code is mapped
+ * twice, once executable and once writable, so threads can run it while
+ * another one adds to it or patches it. Addresses handed out are in the
+ * executable mapping; write through getWritable().
+ */
+class ExecutableAllocator
+{
+public:
+    // Every buffer handed out starts at a multiple of this
+    static const size_t CODE_ALIGNMENT = 16;
+
+    ExecutableAllocator(size_t reserveSize = DEFAULT_RESERVE);
+    ~ExecutableAllocator();
+
+    void *getBuffer(size_t minSize, size_t *available);
+    void *commit(size_t used);
+
+    void *getWritable(void *address);
+    ptrdiff_t getWriteOffset();
+
+    size_t getSize();
+    bool contains(void *address);
+
+private:
+    static const size_t DEFAULT_RESERVE = 1ul << 30;
+    static const size_t COMMIT_GRANULE = 64 * 1024;
+
+    int mFile;
+    char *mBase;
+    char *mWritableBase;
+    size_t mReserved;
+    size_t mCommitted;
+    size_t mUsed;
+};
+
+#endif
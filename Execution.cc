@@ -0,0 +1,19 @@
+#include "Execution.hh"
+
+Execution::Execution(Tape *tape) :
+    tape(tape),
+    lower(tape->getLowerBound()),
+    upper(tape->getUpperBound()),
+    cycle(0),
+    state(-1),
+    head(0),
+    fuel(UINT64_MAX),
+    steps(0),
+    exitState(-1)
+{
+}
+
+Execution::~Execution()
+{
+    delete tape;
+}
@@ -0,0 +1,40 @@
+#ifndef EXECUTION_HH__
+#define EXECUTION_HH__
+
+#include <stdint.h>
+
+#include "Tape.hh"
+
+/*
+ * Everything belonging to one run of a compiled function, so the same code
+ * can run any number of times. Generated code keeps a pointer to this in
+ * R12, and reloads R14 and R15 from lower and upper after growing the tape.
+ * These are the tape's bounds pulled in by the JIT's guard slack.
+ * A run that stops short of halting carries on from state and head.
+ */
+class Execution
+{
+public:
+    Execution(Tape *tape);
+    ~Execution();
+
+    Tape *tape;
+    unsigned char *lower;
+    unsigned char *upper;
+    unsigned int cycle;
+
+    // Where the machine is, between calls to JIT::resume()
+    int state;
+    unsigned char *head;
+
+    // State entries left before the run stops, which compiled code counts
+    // down in R13, and the number used so far. A superblock counts as one.
+    uint64_t fuel;
+    uint64_t steps;
+
+    // State that compiled code stopped at, on returning to the interpreter
+    // or running out of fuel
+    int exitState;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#include <err.h>
+
+#include "Interpreter.hh"
+#include "JIT.hh"
+
+using namespace std;
+
+// Rules must be in the order they are tested. A threshold of zero keeps
+// every state in the interpreter.
+Interpreter::Interpreter(JIT *jit,
+                         vector<vector<Rule *> > &stateRules,
+                         int haltState,
+                         int tapeCount,
+                         unsigned int threshold,
+                         bool trace) :
+    mJIT(jit),
+    mTapeCount(tapeCount),
+    mTiered(threshold != 0),
+    mTrace(trace),
+    mOpcodes(stateRules.size(), OP_STEP),
+    mCounters(stateRules.size(), threshold),
+    mStateEntries(0),
+    mRuleCounts(0)
+{
+    int firstRule = 0;
+    for (unsigned int state = 0; state < stateRules.size(); state++) {
+        vector<Rule *> &rules = stateRules[state];
+        int rule = firstRule;
+        firstRule += rules.size();
+        mFirstTransitions.push_back(mTransitions.size());
+        if ((int)state == haltState) {
+            mOpcodes[state] = OP_HALT;
+            continue;
+        }
+
+        for (vector<Rule *>::iterator i = rules.begin(); i != rules.end(); i++) {
+            Transition transition;
+            transition.rule = rule++;
+            transition.first = mCells.size();
+
+            Pattern *condition = (*i)->getCondition();
+            for (unsigned int j = 0; j < (*i)->getConditionSize(); j++) {
+                Cell cell = { condition[j].getTape(),
+                              condition[j].getSymbol() };
+                mCells.push_back(cell);
+            }
+            transition.actions = mCells.size();
+
+            Pattern *action = (*i)->getAction();
+            for (unsigned int j = 0; j < (*i)->getActionSize(); j++) {
+                Cell cell = { action[j].getTape(), action[j].getSymbol() };
+                mCells.push_back(cell);
+            }
+            transition.end = mCells.size();
+
+            transition.delta = (*i)->getDelta() * tapeCount;
+            transition.to = (*i)->getToState();
+            mTransitions.push_back(transition);
+        }
+    }
+    mFirstTransitions.push_back(mTransitions.size());
+}
+
+// Counts a step down to zero, where it stays. Threads sharing the counters
+// race here only until their states are compiled, so this can afford to be
+// atomic.
+static bool CountDown(unsigned int *counter)
+{
+    unsigned int count = __atomic_load_n(counter, __ATOMIC_RELAXED);
+    while (count &&
+           !__atomic_compare_exchange_n(counter, &count, count - 1, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+    return count <= 1;
+}
+
+// Runs from state until a state that should be run compiled, or until the
+// execution runs out of fuel, returning the head and leaving the state to
+// carry on from in state
+unsigned char *Interpreter::run(int &state,
+                                unsigned char *head,
+                                Execution &execution)
+{
+    static void *const dispatch[] = { &&step, &&halt, &&exit };
+
+    const unsigned char *opcodes = &mOpcodes[0];
+    unsigned int *counters = &mCounters[0];
+    const int *firstTransitions = &mFirstTransitions[0];
+    const Transition *transitions = mTransitions.empty() ? 0 : &mTransitions[0];
+    const Cell *cells = mCells.empty() ? 0 : &mCells[0];
+    Tape *tape = execution.tape;
+    unsigned char *lower = tape->getLowerBound();
+    unsigned char *upper = tape->getUpperBound();
+    uint64_t fuel = execution.fuel;
+    int s = state;
+
+    goto *dispatch[opcodes[s]];
+
+step:
+    if (mTiered && CountDown(&counters[s]))
+        goto exit;
+
+    if (fuel == 0)
+        goto exit;
+    fuel--;
+
+    if (mStateEntries)
+        mStateEntries[s]++;
+    if (mTrace)
+        mJIT->debugSpam(s, head, &execution);
+
+    if (head < lower || head + mTapeCount > upper) {
+        head = tape->grow(head);
+        lower = tape->getLowerBound();
+        upper = tape->getUpperBound();
+    }
+
+    for (const Transition *t = transitions + firstTransitions[s],
+             *end = transitions + firstTransitions[s + 1];
+         t != end;
+         t++)
+    {
+        const Cell *c = cells + t->first;
+        const Cell *actions = cells + t->actions;
+        while (c != actions && head[c->tape] == c->symbol)
+            c++;
+        if (c != actions)
+            continue;
+
+        if (mRuleCounts)
+            mRuleCounts[t->rule]++;
+        for (const Cell *end = cells + t->end; c != end; c++)
+            head[c->tape] = c->symbol;
+        head += t->delta;
+        s = t->to;
+        goto *dispatch[opcodes[s]];
+    }
+    errx(1, "No rule matches in state %d", s);
+
+halt:
+    if (mStateEntries)
+        mStateEntries[s]++;
+    if (mTrace)
+        mJIT->debugSpam(s, head, &execution);
+
+exit:
+    execution.fuel = fuel;
+    state = s;
+    return head;
+}
+
+bool Interpreter::isHot(int state)
+{
+    return mOpcodes[state] != OP_STEP ||
+           (mTiered && __atomic_load_n(&mCounters[state], __ATOMIC_RELAXED) == 0);
+}
+
+// Counts entries to each state and hits on each rule, numbered across all
+// states, into these arrays as well
+void Interpreter::setCounts(uint64_t *stateEntries, uint64_t *ruleCounts)
+{
+    mStateEntries = stateEntries;
+    mRuleCounts = ruleCounts;
+}
+
+void Interpreter::setCompiled(int state)
+{
+    if (mOpcodes[state] == OP_STEP)
+        __atomic_store_n(&mOpcodes[state], (unsigned char)OP_EXIT,
+                         __ATOMIC_RELAXED);
+}
@@ -0,0 +1,80 @@
+#ifndef INTERPRETER_HH__
+#define INTERPRETER_HH__
+
+#include <stdint.h>
+#include <vector>
+
+#include "Execution.hh"
+#include "Rule.hh"
+
+class JIT;
+
+/*
+ * Tier 0: runs states straight from flat tables, so states that are only
+ * entered a few times never get compiled. Each state's rules are a run of
+ * transitions, most specific first, with their conditions and actions in
+ * one shared array of cells. Entering a state dispatches on its opcode with
+ * computed gotos. A state is hot once it has been entered the threshold
+ * number of times; run() then returns so the JIT can compile it, as it
+ * does on reaching the halting state or a state already compiled, or on
+ * running out of fuel. Each state entry uses up one unit of fuel.
+ */
+class Interpreter
+{
+public:
+    Interpreter(JIT *jit,
+                std::vector<std::vector<Rule *> > &stateRules,
+                int haltState,
+                int tapeCount,
+                unsigned int threshold,
+                bool trace);
+
+    unsigned char *run(int &state, unsigned char *head, Execution &execution);
+    bool isHot(int state);
+    void setCompiled(int state);
+    void setCounts(uint64_t *stateEntries, uint64_t *ruleCounts);
+
+private:
+    enum Opcode {
+        OP_STEP,
+        OP_HALT,
+        OP_EXIT
+    };
+
+    class Cell;
+    class Transition;
+
+    JIT *mJIT;
+    int mTapeCount;
+    bool mTiered;
+    bool mTrace;
+    std::vector<unsigned char> mOpcodes;
+    std::vector<unsigned int> mCounters;
+    std::vector<int> mFirstTransitions;
+    std::vector<Transition> mTransitions;
+    std::vector<Cell> mCells;
+    uint64_t *mStateEntries;
+    uint64_t *mRuleCounts;
+};
+
+class Interpreter::Cell
+{
+public:
+    int tape;
+    unsigned char symbol;
+};
+
+// Conditions are cells [first, actions), actions are cells [actions, end).
+// Rules are numbered across all states, in order.
+class Interpreter::Transition
+{
+public:
+    int rule;
+    int first;
+    int actions;
+    int end;
+    int delta;
+    int to;
+};
+
+#endif
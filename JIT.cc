@@ -1,20 +1,31 @@
 #include <algorithm>
 #include <assert.h>
+#include <cstddef>
 #include <cstring>
 #include <err.h>
-#include <sys/mman.h>
+#include <pthread.h>
 #include <stdint.h>
+#include <time.h>
 #include <unistd.h>
 
+#include "CodeCache.hh"
+#include "DecisionTree.hh"
+#include "Execution.hh"
 #include "JIT.hh"
 #include "MASM.hh"
-#include "xmalloc.h"
+#include "Optimizer.hh"
+#include "PerfMap.hh"
+#include "Profile.hh"
+#include "ScanLoop.hh"
+#include "WideAccess.hh"
 
 using namespace std;
 
 /*
  * RAX: Temporary / Return address
  * RBX: Tape pointer
+ * R12: Execution
+ * R13: Fuel left
  * R14: Tape lower bound
  * R15: Tape upper bound
  * RDI: Temporary / Function parameter
@@ -22,139 +33,449 @@ using namespace std;
  * RDX: Temporary / Function parameter
  */
 
-static int log2(unsigned int x)
+extern "C"
+{
+static void *CompilerStub(void **stateEntry, void *site, JIT *jit,
+                          Execution *execution)
 {
-    int result = 0;
-    while ((x >>= 1))
-        result++;
-    return result;
+    return jit->linkState(stateEntry, site, execution);
 }
-
-static void *NewBuffer()
+static void *GrowStub(unsigned char *tapePtr, JIT *jit, Execution *execution)
 {
-    void *result = mmap(0,
-                        4096,
-                        PROT_EXEC | PROT_READ | PROT_WRITE,
-                        MAP_ANONYMOUS | MAP_PRIVATE,
-                        -1,
-                        0);
-    if (!result)
-        err(1, "Unable to allocate JIT buffer");
-    return result;
+    return jit->growTape(tapePtr, execution);
 }
-
-// FIXME: Free buffers
-//static void DeleteBuffer(void *buffer)
-//{
-//    munmap(buffer, 4096);
-//}
-
-extern "C"
+static unsigned char *ScanStub(unsigned char *tapePtr,
+                               unsigned char *lower,
+                               unsigned char *upper,
+                               ScanLoop *loop)
 {
-static void *CompilerStub(void **stateEntry, JIT *jit)
+    return loop->scan(tapePtr, lower, upper);
+}
+static unsigned char *FuelScanStub(unsigned char *tapePtr,
+                                   unsigned char *lower,
+                                   unsigned char *upper,
+                                   ScanLoop *loop,
+                                   Execution *execution)
+{
+    return loop->scan(tapePtr, lower, upper, &execution->fuel);
+}
+static void *CompileWorker(void *jit)
 {
-    return jit->compileState(stateEntry);
+    ((JIT *)jit)->compileWorker();
+    return 0;
 }
-static void *GrowStub(unsigned char *tapePtr, JIT *jit)
+static void SuperblockStub(JIT *jit, int state)
 {
-    return jit->growTape(tapePtr);
+    jit->formSuperblock(state);
 }
-static void DebugStub(JIT *jit, unsigned int state, unsigned char *tapePtr)
+static void DebugStub(JIT *jit, unsigned int state, unsigned char *tapePtr,
+                      Execution *execution)
 {
-    jit->debugSpam(state, tapePtr);
+    jit->debugSpam(state, tapePtr, execution);
 }
 }
 
-JIT::JIT(Function *func, unsigned int *params) :
-    mFunction(func),
-    mParameters(params)
+static bool RuleCompare(Rule *l, Rule *r)
 {
+    return l->getConditionSize() > r->getConditionSize();
 }
 
-int JIT::run()
+// Whether some tape could satisfy both rules' conditions at once
+static bool Overlaps(Rule *l, Rule *r)
 {
-    // Figure out max state and max tape
-    int maxState = 0;
-    int maxTape = mFunction->getArity();
-    vector<Rule *> *rules = mFunction->getMachine()->getRules();
-    for (vector<Rule *>::iterator i = rules->begin();
-         i != rules->end();
-         i++)
-    {
-        maxState = max(maxState, (*i)->getToState());
-
-        vector<Pattern *> *vec = (*i)->getCondition();
-        for (vector<Pattern *>::iterator j = vec->begin();
-             j != vec->end();
-             j++)
-        {
-            maxTape = max(maxTape, (*j)->getTape());
-        }
-        vec = (*i)->getAction();
-        for (vector<Pattern *>::iterator j = vec->begin();
-             j != vec->end();
-             j++)
-        {
-            maxTape = max(maxTape, (*j)->getTape());
+    Pattern *lc = l->getCondition();
+    Pattern *rc = r->getCondition();
+    for (unsigned int i = 0; i < l->getConditionSize(); i++) {
+        for (unsigned int j = 0; j < r->getConditionSize(); j++) {
+            if (lc[i].getTape() == rc[j].getTape() &&
+                lc[i].getSymbol() != rc[j].getSymbol())
+                return false;
         }
     }
+    return true;
+}
 
-    mStateCount = maxState + 1;
-    mTapeCount = maxTape + 1;
+// Writes s as a JSON string, quotes included. Names are whatever atoms
+// the machine file had, so they may hold quotes or backslashes.
+static void WriteJSONString(FILE *out, const char *s)
+{
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = *s;
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+    fputc('"', out);
+}
 
-    // Figure out initial tape length
-    // Note that this includes two hashes on the front and back of the value
-    int maxParam = 2;
-    for (int i = 0; i < mFunction->getArity(); i++)
-        maxParam = max(maxParam, log2(mParameters[i]) + 1 + 2);
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+JIT::Options::Options() :
+    traceLevel(TRACE_NONE),
+    tapeKind(Tape::CHECKED),
+    tapeGrowthFactor(2),
+    tapeRecenter(true),
+    superblockThreshold(1000),
+    tierUpThreshold(16),
+    interpretOnly(false),
+    eager(false),
+    compileThreads(1),
+    fuel(false),
+    stepLimit(0),
+    perfMap(false),
+    jitdump(false),
+    stats(false),
+    optimize(true)
+{
+}
+
+JIT::JIT(Function *func, const Options &options) :
+    mFunction(func),
+    mMachine(0),
+    mTraceLevel(options.traceLevel),
+    mTapeKind(options.tapeKind),
+    mTapeGrowthFactor(options.tapeGrowthFactor),
+    mTapeRecenter(options.tapeRecenter),
+    mSuperblockThreshold(options.superblockThreshold),
+    mTierUpThreshold(options.tierUpThreshold),
+    mInterpretOnly(options.interpretOnly),
+    mEager(options.eager),
+    mCompileThreads(options.compileThreads),
+    mCacheDirectory(options.cacheDirectory),
+    mFuel(options.fuel || options.stepLimit),
+    mStats(options.stats),
+    mPerfMap(0),
+    mStateArray(0),
+    mInterpreter(0),
+    mGuardSlack(0),
+    mTapeGrows(0)
+{
+    pthread_mutex_init(&mLock, 0);
+    if (options.perfMap || options.jitdump)
+        mPerfMap = PerfMap::open(options.jitdump);
+
+    mMachine = mFunction->getMachine();
+    if (options.optimize) {
+        unsigned int ruleCount = mMachine->getRuleCount();
+        mMachine = Optimizer(mMachine).optimize();
+        if (mTraceLevel >= TRACE_COMPILE)
+            printf("Optimized %u rules down to %u\n", ruleCount,
+                   mMachine->getRuleCount());
+    }
+
+    mStateCount = mMachine->getStateCount();
+    mTapeCount = max(mMachine->getTapeCount(), mFunction->getArity() + 1);
+
+    // Superblocks skip the debug stubs of the states they cover
+    if (mTraceLevel >= TRACE_TAPE)
+        mSuperblockThreshold = 0;
+
+    // Hits from a training run, if we have them
+    Profile profile(options.profile);
+    bool profiled = !options.profile.empty() &&
+                    profile.load(*mFunction->getName(),
+                                 mMachine->getRuleCount());
 
     // Set up machine state
     mStateArray = new void*[mStateCount];
-    mTapeSize = maxParam * mTapeCount;
-    mTape = new unsigned char[mTapeSize];
+    mStateRules.resize(mStateCount);
+    mScanLoops.assign(mStateCount, (ScanLoop *)0);
+    mStateCounters.assign(mStateCount, mSuperblockThreshold);
+    mSuperblockFailed.assign(mStateCount, false);
+    mBodyOffsets.assign(mStateCount, 0);
+    mLinkSites.resize(mStateCount);
+    for (int i = 0; i < mStateCount; i++) {
+        // Sort by specificity, most specific first
+        Rule *rules = mMachine->getStateRules(i);
+        for (unsigned int j = 0; j < mMachine->getStateRuleCount(i); j++)
+            mStateRules[i].push_back(&rules[j]);
+        stable_sort(mStateRules[i].begin(), mStateRules[i].end(), RuleCompare);
+        mFirstRules.push_back(mRuleCounts.size());
+        mRuleCounts.resize(mRuleCounts.size() + mStateRules[i].size(), 0);
 
-    memset(mTape, 0xffu, mTapeSize);
-    for (int i = 0; i < mFunction->getArity(); i++) {
-        mTape[i] = 2; // Hash
-        int j;
-        unsigned int parami = mParameters[i];
-        for (j = 1; parami != 0; j++) {
-            mTape[mTapeCount * j + i] = parami % 2;
-            parami >>= 1;
+        if (profiled) {
+            vector<uint64_t> hits;
+            for (vector<Rule *>::iterator j = mStateRules[i].begin();
+                 j != mStateRules[i].end();
+                 j++)
+            {
+                hits.push_back(profile.getCounts()[*j - mMachine->getRules()]);
+            }
+            orderRules(mStateRules[i], hits);
+            mProfileCounts.insert(mProfileCounts.end(),
+                                  hits.begin(), hits.end());
         }
-        mTape[mTapeCount * j + i] = 2; // Hash
     }
-
-    mCycle = 0;
+    mFirstRules.push_back(mRuleCounts.size());
+    if (mTapeKind == Tape::CHECKED)
+        mGuardSlack = GUARD_SLACK * mTapeCount;
+    findTapeGuards();
+    if (mTapeKind == Tape::CHECKED && mTraceLevel >= TRACE_COMPILE) {
+        printf("Checking tape bounds in %d of %d states\n",
+               (int)count(mTapeGuards.begin(), mTapeGuards.end(), true),
+               mStateCount);
+    }
+    if (mStats) {
+        mStateEntries.assign(mStateCount, 0);
+        mCompileNanoseconds.assign(mStateCount, 0);
+        mCodeBytes.assign(mStateCount, 0);
+        mSuperblockBytes.assign(mStateCount, 0);
+    }
 
     // Build trampolines
-    buildInitialTrampoline();
-    buildCompilerTrampoline();
-    buildGrowTrampoline();
+    mInitialTrampoline = emitCode(&JIT::buildInitialTrampoline, -1,
+                                  "initial trampoline");
+    mCompilerTrampoline = emitCode(&JIT::buildCompilerTrampoline, -1,
+                                   "compiler trampoline");
+    mGrowTrampoline = emitCode(&JIT::buildGrowTrampoline, -1,
+                               "grow trampoline");
+    mExitTrampoline = emitCode(&JIT::buildExitTrampoline, -1,
+                               "exit trampoline");
 
     // Populate initial state table
-    for (int i = 0; i <= maxState; i++)
+    for (int i = 0; i < mStateCount; i++)
         mStateArray[i] = mCompilerTrampoline;
 
-    // Jump!
+    if (mEager) {
+        layOutStates();
+        if (mCacheDirectory.empty() || !loadCache())
+            compileAll();
+    } else if (mTierUpThreshold || mInterpretOnly) {
+        mInterpreter = new Interpreter(this, mStateRules,
+                                       mMachine->getHaltState(), mTapeCount,
+                                       mInterpretOnly ? 0 : mTierUpThreshold,
+                                       mTraceLevel >= TRACE_TAPE);
+        if (mStats)
+            mInterpreter->setCounts(&mStateEntries[0], &mRuleCounts[0]);
+    }
+}
+
+JIT::~JIT()
+{
+    delete[] mStateArray;
+    for (vector<ScanLoop *>::iterator i = mScanLoops.begin();
+         i != mScanLoops.end();
+         i++)
+    {
+        delete *i;
+    }
+    delete mInterpreter;
+    if (mMachine != mFunction->getMachine())
+        delete mMachine;
+    pthread_mutex_destroy(&mLock);
+}
+
+int JIT::getTapeCount()
+{
+    return mTapeCount;
+}
+
+// Bytes of generated code, trampolines included
+size_t JIT::getCodeSize()
+{
+    return mCode.getSize();
+}
+
+Tape *JIT::createTape(int cells)
+{
+    // Leave room for the first check, with the head on cell 1
+    return new Tape(mTapeKind, mTapeCount, cells,
+                    mTapeGrowthFactor, mTapeRecenter, GUARD_SLACK);
+}
+
+// Puts the machine in its initial state with the head on cell 1 of the
+// execution's tape
+void JIT::start(Execution &execution)
+{
+    execution.state = mMachine->getInitState();
+    execution.head = execution.tape->getCell(1);
+}
+
+// Runs the machine until it halts, returning true, or until it runs out of
+// fuel. The execution may carry on from there on any thread.
+bool JIT::resume(Execution &execution)
+{
+    // Alternate between the interpreter and compiled code, which returns
+    // on halting, running out of fuel or reaching a state still left to
+    // the interpreter
     // FIXME: Hideous
-    unsigned char *tapePtr = ((unsigned char *(*)(void *, void *, void *))mInitialTrampoline)(mTape + mTapeCount, mTape, mTape + mTapeSize);
+    typedef unsigned char *(*Trampoline)(void *, void *, void *, void **,
+                                         Execution *);
+    execution.tape->activate(&mCode);
+    setBounds(execution);
+    uint64_t fuel = execution.fuel;
+    unsigned int grows = execution.tape->getGrowCount();
+    unsigned char *tapePtr = execution.head;
+    int state = execution.state;
+    while (state != mMachine->getHaltState() && execution.fuel) {
+        if (mInterpreter) {
+            tapePtr = mInterpreter->run(state, tapePtr, execution);
+            setBounds(execution);
+            if (state == mMachine->getHaltState() || !execution.fuel)
+                break;
+        }
+
+        // States without guards of their own count on being entered
+        // with the head inside the checked bounds
+        if (mTapeKind == Tape::CHECKED &&
+            (tapePtr < execution.lower || tapePtr >= execution.upper))
+            tapePtr = growTape(tapePtr, &execution);
 
-    // Extract our result
-    int result = 0;
-    int multiplier = 1;
-    for (int j = 0; tapePtr[mTapeCount * j + mFunction->getArity()] != 2; j++) {
-        result = result + multiplier * tapePtr[mTapeCount * j + mFunction->getArity()];
-        multiplier *= 2;
+        execution.exitState = mMachine->getHaltState();
+        tapePtr = ((Trampoline)mInitialTrampoline)(tapePtr,
+                                                   execution.lower,
+                                                   execution.upper,
+                                                   &mStateArray[state],
+                                                   &execution);
+        state = execution.exitState;
     }
 
-    // Return something useful
-    return result;
+    execution.steps += fuel - execution.fuel;
+    if (mStats) {
+        __sync_fetch_and_add(&mTapeGrows,
+                             execution.tape->getGrowCount() - grows);
+    }
+    execution.head = tapePtr;
+    execution.state = state;
+    return state == mMachine->getHaltState();
 }
 
-static bool RuleCompare(Rule *l, Rule *r)
+bool JIT::isHalted(Execution &execution)
+{
+    return execution.state == mMachine->getHaltState();
+}
+
+// Reports what Options::stats counted: per state, how often it was entered,
+// how much code it got and how long that took, and how often each of its
+// rules fired. Counters aren't atomic, so runs on several threads may lose
+// a few.
+void JIT::writeStats(FILE *out, bool json)
+{
+    if (!mStats)
+        return;
+
+    uint64_t transitions = 0;
+    uint64_t codeBytes = 0;
+    uint64_t compileNanoseconds = 0;
+    for (int s = 0; s < mStateCount; s++) {
+        codeBytes += mCodeBytes[s] + mSuperblockBytes[s];
+        compileNanoseconds += mCompileNanoseconds[s];
+    }
+    for (vector<uint64_t>::iterator i = mRuleCounts.begin();
+         i != mRuleCounts.end();
+         i++)
+    {
+        transitions += *i;
+    }
+
+    const char *name = mFunction->getName()->c_str();
+    if (json) {
+        fprintf(out, "{\"function\": ");
+        WriteJSONString(out, name);
+        fprintf(out, ", \"transitions\": %llu, "
+                "\"tapeGrows\": %llu, \"codeBytes\": %llu, "
+                "\"compileNanoseconds\": %llu, \"states\": [",
+                (unsigned long long)transitions,
+                (unsigned long long)mTapeGrows,
+                (unsigned long long)codeBytes,
+                (unsigned long long)compileNanoseconds);
+    } else {
+        fprintf(out, "%s: %llu transitions, %llu tape grows, "
+                "%llu bytes of code compiled in %.3f ms\n",
+                name, (unsigned long long)transitions,
+                (unsigned long long)mTapeGrows,
+                (unsigned long long)codeBytes, compileNanoseconds / 1e6);
+    }
+
+    bool first = true;
+    for (int s = 0; s < mStateCount; s++) {
+        vector<Rule *> &rules = mStateRules[s];
+        bool compiled = mStateArray[s] != mCompilerTrampoline;
+        if (!mStateEntries[s] && !compiled)
+            continue;
+
+        if (json) {
+            fprintf(out, "%s\n  {\"state\": %d, \"entries\": %llu, "
+                    "\"compiled\": %s, \"codeBytes\": %u, "
+                    "\"superblockBytes\": %u, "
+                    "\"compileNanoseconds\": %llu, \"rules\": [",
+                    first ? "" : ",", s,
+                    (unsigned long long)mStateEntries[s],
+                    compiled ? "true" : "false", mCodeBytes[s],
+                    mSuperblockBytes[s],
+                    (unsigned long long)mCompileNanoseconds[s]);
+        } else {
+            fprintf(out, "  state %d: %llu entries", s,
+                    (unsigned long long)mStateEntries[s]);
+            if (compiled) {
+                fprintf(out, ", %u bytes", mCodeBytes[s]);
+                if (mSuperblockBytes[s])
+                    fprintf(out, " + %u in superblocks", mSuperblockBytes[s]);
+                fprintf(out, " in %.3f ms", mCompileNanoseconds[s] / 1e6);
+            } else {
+                fprintf(out, ", interpreted");
+            }
+            fprintf(out, "\n");
+        }
+        first = false;
+
+        for (unsigned int i = 0; i < rules.size(); i++) {
+            uint64_t hits = mRuleCounts[mFirstRules[s] + i];
+            if (json) {
+                fprintf(out, "%s{\"to\": %d, \"hits\": %llu}",
+                        i ? ", " : "", rules[i]->getToState(),
+                        (unsigned long long)hits);
+            } else if (hits) {
+                fprintf(out, "    rule %u -> %d: %llu hits (%.1f%%)\n",
+                        i, rules[i]->getToState(), (unsigned long long)hits,
+                        100.0 * hits / mStateEntries[s]);
+            }
+        }
+        if (json)
+            fprintf(out, "]}");
+    }
+    if (json)
+        fprintf(out, "\n]}\n");
+}
+
+// Saves the rule hits counted with Options::stats as a profile for later
+// runs to compile with
+void JIT::writeProfile(const string &path)
+{
+    assert(mStats);
+
+    Profile profile(path);
+    profile.getCounts().assign(mMachine->getRuleCount(), 0);
+    for (int s = 0; s < mStateCount; s++) {
+        for (unsigned int i = 0; i < mStateRules[s].size(); i++) {
+            profile.getCounts()[mStateRules[s][i] - mMachine->getRules()] =
+                mRuleCounts[mFirstRules[s] + i];
+        }
+    }
+    profile.save(*mFunction->getName());
+}
+
+// Compiles a state now rather than when it is first entered, returning
+// its code
+void *JIT::compile(int state)
 {
-    return l->getCondition()->size() > r->getCondition()->size();
+    assert(0 <= state && state < mStateCount);
+
+    pthread_mutex_lock(&mLock);
+    void *code = mStateArray[state];
+    if (code == mCompilerTrampoline)
+        code = compileState(&mStateArray[state]);
+    pthread_mutex_unlock(&mLock);
+    return code;
 }
 
 void *JIT::compileState(void **stateEntry)
@@ -164,210 +485,1133 @@ void *JIT::compileState(void **stateEntry)
     assert(0 <= state && state < mStateCount);
     assert(mStateArray[state] == mCompilerTrampoline);
 
-    printf("Compiling state %d\n", state);
+    if (mTraceLevel >= TRACE_COMPILE)
+        printf("Compiling state %d\n", state);
 
-    mStateArray[state] = NewBuffer();
-    MASM masm(mStateArray[state]);
+    // Other threads read the entry without taking the lock, so it must only
+    // be published once the code behind it is complete
+    uint64_t start = mStats ? Now() : 0;
+    size_t size;
+    void *code = emitCode(&JIT::emitState, state, "state", &size);
+    if (mStats) {
+        mCompileNanoseconds[state] += Now() - start;
+        mCodeBytes[state] = size;
+    }
+    __atomic_store_n(&mStateArray[state], code, __ATOMIC_RELEASE);
+    if (mInterpreter)
+        mInterpreter->setCompiled(state);
+    return code;
+}
+
+void JIT::emitState(MASM &masm, int state)
+{
+    bool halting = state == mMachine->getHaltState();
+    vector<Rule *> &rules = mStateRules[state];
+
+    // Skip straight over cells that would just loop back here. This would
+    // hide steps from the tape dumps, so leave it out when tracing them.
+    if (!halting && mTraceLevel < TRACE_TAPE && !mScanLoops[state])
+        mScanLoops[state] = ScanLoop::create(state, rules, mTapeCount);
 
-    Machine *mach = mFunction->getMachine();
+    // Count entries until this state is hot enough for a superblock. The
+    // first instruction is a jump to the next one, which formSuperblock
+    // retargets; side exits from superblocks skip to the body after this.
+    // Superblocks are never formed when tracing, so that jump is first.
+    bool profile = !halting && mSuperblockThreshold && !mScanLoops[state];
+    if (profile) {
+        MASM::Jump entry = masm.jump32();
+        assert(entry.getOffsetBase() == 1);
+        masm.link(entry, masm.label());
+    }
+
+    // Stop before running this state if we're out of fuel
+    MASM::Jump outOfFuel(0, 0);
+    if (mFuel && !halting)
+        outOfFuel = emitFuelCheck(masm);
 
     // Call status updater
-    masm.move64(MASM::RDI, (uint64_t)this);
-    masm.move64(MASM::RSI, state);
-    masm.move64(MASM::RDX, MASM::RBX);
-    masm.move64(MASM::RAX, (uint64_t)DebugStub);
-    masm.call(MASM::RAX);
+    if (mTraceLevel >= TRACE_TAPE) {
+        moveSymbol(masm, MASM::RDI, SYMBOL_JIT);
+        masm.move64(MASM::RSI, state);
+        masm.move64(MASM::RDX, MASM::RBX);
+        masm.move64(MASM::RCX, MASM::R12);
+        moveSymbol(masm, MASM::RAX, SYMBOL_DEBUG_STUB);
+        masm.call(MASM::RAX);
+    }
+
+    if (mStats) {
+        moveSymbol(masm, MASM::RAX, SYMBOL_STATE_ENTRIES, state);
+        masm.increment64(MASM::Location(MASM::RAX));
+    }
 
     // Check halting state
-    if (state == mach->getHaltState()) {
+    if (halting) {
         masm.ret();
-        return mStateArray[state];
+        return;
     }
 
-    // Emit negative tape guard
-    masm.compare64(MASM::RBX, MASM::R14);
-    MASM::Jump upperPass = masm.jump32(MASM::COND_NOT_LESS);
-    masm.move64(MASM::RAX, (uint64_t)mGrowTrampoline);
-    masm.call(MASM::RAX);
+    MASM::Jump hot(0, 0);
+    MASM::Label resume(0);
+    if (profile) {
+        moveSymbol(masm, MASM::RAX, SYMBOL_STATE_COUNTER, state);
+        masm.decrement32(MASM::Location(MASM::RAX));
+        hot = masm.jump32(MASM::COND_EQUAL);
+        resume = masm.label();
+        mBodyOffsets[state] = resume.getOffset();
+    }
+
+    // Guarded tapes grow by themselves, and states entered close enough
+    // to the last check need none
+    vector<MASM::Jump> grows;
+    MASM::Label guards(0);
+    if (mTapeKind == Tape::CHECKED && mTapeGuards[state])
+        guards = emitTapeGuards(masm, grows);
+
+    // A scan can run for ever, so it counts cells against the fuel
+    if (mScanLoops[state]) {
+        MASM::Location fuel(MASM::R12, 0, 0, offsetof(Execution, fuel));
+        masm.move64(MASM::RDI, MASM::RBX);
+        masm.move64(MASM::RSI, MASM::R14);
+        masm.move64(MASM::RDX, MASM::R15);
+        moveSymbol(masm, MASM::RCX, SYMBOL_SCAN_LOOP, state);
+        if (mFuel) {
+            masm.store64(fuel, MASM::R13);
+            masm.move64(MASM::R8, MASM::R12);
+            moveSymbol(masm, MASM::RAX, SYMBOL_FUEL_SCAN_STUB);
+        } else {
+            moveSymbol(masm, MASM::RAX, SYMBOL_SCAN_STUB);
+        }
+        masm.call(MASM::RAX);
+        masm.move64(MASM::RBX, MASM::RAX);
+        if (mFuel)
+            masm.load64(MASM::R13, fuel);
+    }
+
+    // Dispatch on the tape cells to find the first matching rule
+    vector<vector<MASM::Jump> > actionJumps(rules.size());
+    vector<MASM::Jump> nextRuleJumps;
+    DecisionTree(rules).emit(masm, actionJumps, nextRuleJumps);
+
+    // Emit the action of each rule that can be selected, leaving any that
+    // falls through to the next state until last
+    int fallThrough = mFallThrough.empty() ? -1 : mFallThrough[state];
+    if (fallThrough >= 0 && actionJumps[fallThrough].empty())
+        fallThrough = -1;
+    vector<pair<MASM::Jump, int> > nextStateJumps;
+    for (unsigned int i = 0; i < rules.size(); i++) {
+        if (!actionJumps[i].empty() && (int)i != fallThrough) {
+            emitAction(masm, state, i, actionJumps[i], profile || mStats,
+                       false, nextStateJumps);
+        }
+    }
+
+    // Everything from here to the last action is off the hot path.
+    // If we didn't make any matches, die.
+    for (vector<MASM::Jump>::iterator i = nextRuleJumps.begin();
+         i != nextRuleJumps.end();
+         i++)
+    {
+        masm.link(*i, masm.label());
+    }
+    masm.die();
+
+    // Form the superblock out of line, then carry on in this state
+    if (profile) {
+        masm.link(hot, masm.label());
+        moveSymbol(masm, MASM::RDI, SYMBOL_JIT);
+        masm.move64(MASM::RSI, state);
+        moveSymbol(masm, MASM::RAX, SYMBOL_SUPERBLOCK_STUB);
+        masm.call(MASM::RAX);
+        masm.link(masm.jump32(), resume);
+    }
+
+    if (mFuel)
+        emitYield(masm, outOfFuel, state);
+
+    if (!grows.empty())
+        emitGrowStub(masm, grows, guards);
+
+    // Remember the transitions, so that states compiled together can be
+    // linked to each other once they are all in place
+    mLinkSites[state].clear();
+    for (vector<pair<MASM::Jump, int> >::iterator i = nextStateJumps.begin();
+         i != nextStateJumps.end();
+         i++)
+    {
+        mLinkSites[state].push_back(make_pair(i->first.getOffsetBase(),
+                                              i->second));
+    }
+
+    emitLinkStubs(masm, nextStateJumps);
+
+    // The next state's code starts at the next multiple of the code
+    // alignment, so pad up to it
+    if (fallThrough >= 0) {
+        vector<pair<MASM::Jump, int> > none;
+        emitAction(masm, state, fallThrough, actionJumps[fallThrough],
+                   profile || mStats, true, none);
+        masm.align(ExecutableAllocator::CODE_ALIGNMENT);
+    }
+}
+
+// Emits the writes and head move of one of the state's rules, counting
+// its hits if asked, then jumps to its next state unless that comes
+// straight after
+void JIT::emitAction(MASM &masm,
+                     int state,
+                     int rule,
+                     vector<MASM::Jump> &actionJumps,
+                     bool count,
+                     bool fallThrough,
+                     vector<pair<MASM::Jump, int> > &nextStateJumps)
+{
+    for (vector<MASM::Jump>::iterator i = actionJumps.begin();
+         i != actionJumps.end();
+         i++)
+    {
+        masm.link(*i, masm.label());
+    }
+
+    if (count) {
+        moveSymbol(masm, MASM::RAX, SYMBOL_RULE_COUNT,
+                   mFirstRules[state] + rule);
+        masm.increment64(MASM::Location(MASM::RAX));
+    }
+
+    // Emit action, later patterns for the same tape winning
+    Rule *r = mStateRules[state][rule];
+    map<int, int> cells;
+    Pattern *action = r->getAction();
+    for (unsigned int i = 0; i < r->getActionSize(); i++)
+        cells[action[i].getTape()] = action[i].getSymbol();
+    WideAccess::emitStore(masm, cells, 0);
+
+    // Add tape delta
+    masm.add32(MASM::RBX, r->getDelta() * mTapeCount);
+
+    // Jump to next state
+    if (fallThrough)
+        return;
+    int to = r->getToState();
+    MASM::Jump next = masm.patchableJump32();
+    if (to == state)
+        masm.link(next, MASM::Label(0));
+    else
+        emitStateJump(masm, next, to, nextStateJumps);
+}
+
+void JIT::formSuperblock(int state)
+{
+    pthread_mutex_lock(&mLock);
+    doFormSuperblock(state);
+    pthread_mutex_unlock(&mLock);
+}
+
+void JIT::doFormSuperblock(int state)
+{
+    // Threads can race each other to the end of the countdown, and only the
+    // first to get here forms the superblock
+    if (*(int32_t *)((char *)mStateArray[state] + 1) != 0 ||
+        mSuperblockFailed[state])
+        return;
+
+    // Follow the hottest rule out of each state until we loop back, reach a
+    // state already on the path, or reach one that never gets a superblock
+    mSuperblockPath.clear();
+    vector<bool> onPath(mStateCount, false);
+    int s = state;
+    while (mSuperblockPath.size() < MAX_SUPERBLOCK_LENGTH &&
+           s != mMachine->getHaltState() &&
+           !onPath[s] &&
+           !mScanLoops[s] &&
+           mStateArray[s] != mCompilerTrampoline)
+    {
+        uint64_t *counts = &mRuleCounts[mFirstRules[s]];
+        int hottest = -1;
+        for (unsigned int i = 0; i < mStateRules[s].size(); i++) {
+            if (counts[i] && (hottest < 0 || counts[i] > counts[hottest]))
+                hottest = i;
+        }
+        if (hottest < 0)
+            break;
+
+        onPath[s] = true;
+        mSuperblockPath.push_back(make_pair(s, hottest));
+        s = mStateRules[s][hottest]->getToState();
+    }
+
+    // Nothing to go on yet, so try again later
+    if (mSuperblockPath.empty()) {
+        mStateCounters[state] = mSuperblockThreshold;
+        return;
+    }
+
+    if (mTraceLevel >= TRACE_COMPILE) {
+        printf("Forming superblock for state %d:", state);
+        for (vector<pair<int, int> >::iterator i = mSuperblockPath.begin();
+             i != mSuperblockPath.end();
+             i++)
+        {
+            printf(" %d", i->first);
+        }
+        printf(" -> %d\n", s);
+    }
+
+    uint64_t start = mStats ? Now() : 0;
+    size_t size;
+    void *code = emitCode(&JIT::emitSuperblock, state, "superblock", &size);
+    if (mStats) {
+        mCompileNanoseconds[state] += Now() - start;
+        mSuperblockBytes[state] += size;
+    }
+
+    // The state's first instruction is its entry jump, whose rel32 can't
+    // straddle a cache line in 16-byte aligned code. Code emitted later
+    // would be no nearer, so if the superblock is out of reach, leave the
+    // counter run down: it only comes back round after 2^32 entries, and
+    // then finds the state marked.
+    if (!MASM::relink((char *)mStateArray[state] + 1, code,
+                      mCode.getWriteOffset()))
+    {
+        mSuperblockFailed[state] = true;
+        if (mTraceLevel >= TRACE_COMPILE)
+            printf("Superblock for state %d is out of reach\n", state);
+    }
+}
+
+void JIT::emitSuperblock(MASM &masm, int state)
+{
+    // Take fuel for every state on the path up front; side exits hand back
+    // what they leave untaken
+    int length = mSuperblockPath.size();
+    MASM::Jump shortOfFuel(0, 0);
+    if (mFuel)
+        shortOfFuel = emitFuelCheck(masm, length);
+
+    // The head stays put for the whole superblock, with each step's cells
+    // addressed at a folded offset from it. On a checked tape the offsets
+    // already covered by a bounds check need no further guards.
+    vector<MASM::Jump> grows;
+    MASM::Label guards(0);
+    if (mTapeKind == Tape::CHECKED)
+        guards = emitTapeGuards(masm, grows);
+
+    int offset = 0;
+    int checkedLow = 0;
+    int checkedHigh = 0;
+    vector<vector<MASM::Jump> > exitJumps(mSuperblockPath.size());
+    vector<int> exitOffsets(mSuperblockPath.size());
+    for (unsigned int i = 0; i < mSuperblockPath.size(); i++) {
+        int s = mSuperblockPath[i].first;
+        int selected = mSuperblockPath[i].second;
+        vector<Rule *> &rules = mStateRules[s];
+        Rule *rule = rules[selected];
+        exitOffsets[i] = offset;
 
-    // Emit positive tape guard
-    masm.link(upperPass, masm.label());
+        // Count as the state's code would; side exits go on to count
+        // the rule taken
+        if (mStats) {
+            moveSymbol(masm, MASM::RAX, SYMBOL_STATE_ENTRIES, s);
+            masm.increment64(MASM::Location(MASM::RAX));
+        }
+
+        if (mTapeKind == Tape::CHECKED &&
+            (offset > checkedHigh || offset < checkedLow))
+        {
+            masm.loadAddress(MASM::RAX,
+                             MASM::Location(MASM::RBX, 0, 0, offset));
+            if (offset > checkedHigh) {
+                masm.compare64(MASM::RAX, MASM::R15);
+                exitJumps[i].push_back(masm.jump32(MASM::COND_NOT_LESS));
+                checkedHigh = offset;
+            } else {
+                masm.compare64(MASM::RAX, MASM::R14);
+                exitJumps[i].push_back(masm.jump32(MASM::COND_LESS));
+                checkedLow = offset;
+            }
+        }
+
+        // Any other outcome of this state's dispatch leaves the superblock
+        vector<vector<MASM::Jump> > actionJumps(rules.size());
+        DecisionTree(rules, offset).emit(masm, actionJumps, exitJumps[i]);
+        for (unsigned int j = 0; j < rules.size(); j++) {
+            if (j != (unsigned int)selected) {
+                exitJumps[i].insert(exitJumps[i].end(),
+                                    actionJumps[j].begin(),
+                                    actionJumps[j].end());
+            }
+        }
+        for (vector<MASM::Jump>::iterator j = actionJumps[selected].begin();
+             j != actionJumps[selected].end();
+             j++)
+        {
+            masm.link(*j, masm.label());
+        }
+        if (mStats) {
+            moveSymbol(masm, MASM::RAX, SYMBOL_RULE_COUNT,
+                       mFirstRules[s] + selected);
+            masm.increment64(MASM::Location(MASM::RAX));
+        }
+
+        map<int, int> cells;
+        Pattern *action = rule->getAction();
+        for (unsigned int j = 0; j < rule->getActionSize(); j++)
+            cells[action[j].getTape()] = action[j].getSymbol();
+        WideAccess::emitStore(masm, cells, offset);
+
+        offset += rule->getDelta() * mTapeCount;
+    }
+
+    // Commit the head and carry on, looping back here if we can
+    vector<pair<MASM::Jump, int> > nextStateJumps;
+    int to = mStateRules[mSuperblockPath.back().first]
+                        [mSuperblockPath.back().second]->getToState();
+    if (offset)
+        masm.add32(MASM::RBX, offset);
+    MASM::Jump next = masm.patchableJump32();
+    if (to == state)
+        masm.link(next, MASM::Label(0));
+    else
+        emitStateJump(masm, next, to, nextStateJumps);
+
+    // Side exits commit the head and resume in the state's own code, past
+    // its entry jump so we don't come straight back here
+    for (unsigned int i = 0; i < mSuperblockPath.size(); i++) {
+        if (exitJumps[i].empty())
+            continue;
+
+        for (vector<MASM::Jump>::iterator j = exitJumps[i].begin();
+             j != exitJumps[i].end();
+             j++)
+        {
+            masm.link(*j, masm.label());
+        }
+        if (exitOffsets[i])
+            masm.add32(MASM::RBX, exitOffsets[i]);
+        if (mFuel && length - (int)i - 1)
+            masm.add32(MASM::R13, length - i - 1);
+
+        int s = mSuperblockPath[i].first;
+        void *body = (char *)mStateArray[s] + mBodyOffsets[s];
+        if (!masm.link(masm.jump32(), body)) {
+            masm.move64(MASM::RAX, (uint64_t)body);
+            masm.jumpIndirect(MASM::RAX);
+        }
+    }
+
+    // Without fuel for the whole path, run just this state's own code
+    if (mFuel) {
+        masm.link(shortOfFuel, masm.label());
+        masm.add32(MASM::R13, length);
+        MASM::Jump outOfFuel = emitFuelCheck(masm);
+        if (mStats) {
+            moveSymbol(masm, MASM::RAX, SYMBOL_STATE_ENTRIES, state);
+            masm.increment64(MASM::Location(MASM::RAX));
+        }
+        void *body = (char *)mStateArray[state] + mBodyOffsets[state];
+        if (!masm.link(masm.jump32(), body)) {
+            masm.move64(MASM::RAX, (uint64_t)body);
+            masm.jumpIndirect(MASM::RAX);
+        }
+        emitYield(masm, outOfFuel, state);
+    }
+
+    if (!grows.empty())
+        emitGrowStub(masm, grows, guards);
+
+    emitLinkStubs(masm, nextStateJumps);
+}
+
+// Takes units of fuel from R13, jumping if there weren't that many
+MASM::Jump JIT::emitFuelCheck(MASM &masm, int units)
+{
+    masm.add32(MASM::R13, (uint32_t)-units);
+    return masm.jump32(MASM::COND_NOT_BELOW);
+}
+
+// Leaves the fuel at zero and returns to the initial trampoline, which
+// stores it, to carry on from this state later. The stack is as it was on
+// entry to the state code.
+void JIT::emitYield(MASM &masm, MASM::Jump outOfFuel, int state)
+{
+    masm.link(outOfFuel, masm.label());
+    masm.move64(MASM::R13, 0);
+    masm.store32(MASM::Location(MASM::R12, 0, 0, offsetof(Execution, exitState)),
+                 state);
+    masm.ret();
+}
+
+// Checks the head is within the checked bounds, and so at least the guard
+// slack inside the tape, leaving jumps for emitGrowStub() to take out of
+// line when it isn't. Returns the start of the checks, to come back to once
+// the tape has grown.
+MASM::Label JIT::emitTapeGuards(MASM &masm, vector<MASM::Jump> &grows)
+{
+    MASM::Label guards = masm.label();
+    masm.compare64(MASM::RBX, MASM::R14);
+    grows.push_back(masm.jump32(MASM::COND_LESS));
     masm.compare64(MASM::RBX, MASM::R15);
-    MASM::Jump lowerPass = masm.jump32(MASM::COND_LESS);
-    masm.move64(MASM::RAX, (uint64_t)mGrowTrampoline);
+    grows.push_back(masm.jump32(MASM::COND_NOT_LESS));
+    return guards;
+}
+
+void JIT::emitGrowStub(MASM &masm, vector<MASM::Jump> &grows,
+                       MASM::Label guards)
+{
+    for (vector<MASM::Jump>::iterator i = grows.begin(); i != grows.end(); i++)
+        masm.link(*i, masm.label());
+    moveSymbol(masm, MASM::RAX, SYMBOL_GROW_TRAMPOLINE);
     masm.call(MASM::RAX);
-    masm.link(lowerPass, masm.label());
+    masm.link(masm.jump32(), guards);
+}
+
+void JIT::emitStateJump(MASM &masm,
+                        MASM::Jump jump,
+                        int to,
+                        vector<pair<MASM::Jump, int> > &stubs)
+{
+    // Jump directly if the target has already been compiled
+    if (mStateArray[to] == mCompilerTrampoline ||
+        !masm.link(jump, mStateArray[to]))
+        stubs.push_back(make_pair(jump, to));
+}
 
-    // Sort by specificity, most specific first
-    vector<Rule *> rules;
-    for (vector<Rule *>::iterator i = mach->getRules()->begin();
-         i != mach->getRules()->end();
+void JIT::emitLinkStubs(MASM &masm, vector<pair<MASM::Jump, int> > &stubs)
+{
+    // Emit link stubs for transitions to states we haven't compiled yet.
+    // The compiler trampoline patches the jump to go directly to the
+    // target state, so each stub is only taken once.
+    for (vector<pair<MASM::Jump, int> >::iterator i = stubs.begin();
+         i != stubs.end();
          i++)
     {
-        if ((*i)->getFromState() == state)
-            rules.push_back(*i);
-    }    
-    sort(rules.begin(), rules.end(), RuleCompare);
+        masm.link(i->first, masm.label());
+        moveSymbol(masm, MASM::RDI, SYMBOL_STATE_SLOT, i->second);
+        masm.move64(MASM::RSI, MASM::Label(i->first.getOffsetBase()));
+        moveSymbol(masm, MASM::RAX, SYMBOL_COMPILER_TRAMPOLINE);
+        masm.jumpIndirect(MASM::RAX);
+    }
+}
 
-    // Emit each rule in turn
-    vector<MASM::Jump> nextRuleJumps;
-    vector<MASM::Jump> nextStateJumps;
-    for (vector<Rule *>::iterator i = rules.begin(); i != rules.end(); i++) {
-        Rule *rule = *i;
+// Puts one state's rules, whose hits are given in the same order, in order
+// of hits where that keeps every pair of rules that could both match in
+// their original order, so the first match is always the same rule. Ties
+// keep their order too.
+void JIT::orderRules(vector<Rule *> &rules, vector<uint64_t> &hits)
+{
+    vector<Rule *> ordered;
+    vector<uint64_t> orderedHits;
+    vector<bool> placed(rules.size(), false);
+    while (ordered.size() < rules.size()) {
+        int best = -1;
+        for (unsigned int i = 0; i < rules.size(); i++) {
+            if (placed[i])
+                continue;
+
+            bool ready = true;
+            for (unsigned int j = 0; j < i && ready; j++) {
+                if (!placed[j] && Overlaps(rules[j], rules[i]))
+                    ready = false;
+            }
+            if (ready && (best < 0 || hits[i] > hits[best]))
+                best = i;
+        }
+        placed[best] = true;
+        ordered.push_back(rules[best]);
+        orderedHits.push_back(hits[best]);
+    }
+    rules.swap(ordered);
+    hits.swap(orderedHits);
+}
+
+// Finds the states reachable from the initial state, which is placed
+// first. With a profile, each state is followed by the next state of its
+// hottest rule, unless that has already been placed.
+void JIT::layOutStates()
+{
+    vector<int> reachable;
+    vector<bool> seen(mStateCount, false);
+    reachable.push_back(mMachine->getInitState());
+    seen[mMachine->getInitState()] = true;
+    for (unsigned int i = 0; i < reachable.size(); i++) {
+        vector<Rule *> &rules = mStateRules[reachable[i]];
+        for (vector<Rule *>::iterator j = rules.begin(); j != rules.end(); j++) {
+            int to = (*j)->getToState();
+            if (!seen[to]) {
+                seen[to] = true;
+                reachable.push_back(to);
+            }
+        }
+    }
+
+    mFallThrough.assign(mStateCount, -1);
+    if (mProfileCounts.empty()) {
+        mEagerStates = reachable;
+        return;
+    }
+
+    vector<bool> placed(mStateCount, false);
+    mEagerStates.clear();
+    for (vector<int>::iterator i = reachable.begin();
+         i != reachable.end();
+         i++)
+    {
+        for (int s = *i; s >= 0 && !placed[s]; ) {
+            placed[s] = true;
+            mEagerStates.push_back(s);
 
-        // Link previous rules
-        for (vector<MASM::Jump>::iterator i = nextRuleJumps.begin();
-             i != nextRuleJumps.end();
+            vector<Rule *> &rules = mStateRules[s];
+            uint64_t *hits = &mProfileCounts[mFirstRules[s]];
+            int hottest = -1;
+            for (unsigned int j = 0; j < rules.size(); j++) {
+                if (hits[j] && !placed[rules[j]->getToState()] &&
+                    (hottest < 0 || hits[j] > hits[hottest]))
+                    hottest = j;
+            }
+            mFallThrough[s] = hottest;
+            s = hottest < 0 ? -1 : rules[hottest]->getToState();
+        }
+    }
+}
+
+// Decides which states check the head against the tape bounds on entry.
+// Compiled code is always entered with the head inside the checked bounds,
+// so a state needs a check of its own only if its predecessors, since
+// their last check, can have moved the head more than the guard slack.
+// Each state's range of such moves is widened along the transitions into
+// it until nothing changes, and a state whose range would outgrow the
+// slack gets a check, after which the head has moved nowhere. Any loop
+// that keeps moving the head one way ends up with a check somewhere on it.
+// Superblocks check every offset they read and side exit to the state that
+// read it, having moved only as far as a transition into that state does.
+void JIT::findTapeGuards()
+{
+    vector<int64_t> low(mStateCount, 0);
+    vector<int64_t> high(mStateCount, 0);
+    mTapeGuards.assign(mStateCount, false);
+
+    vector<int> work;
+    vector<bool> queued(mStateCount, true);
+    for (int i = mStateCount - 1; i >= 0; i--)
+        work.push_back(i);
+    while (!work.empty()) {
+        int s = work.back();
+        work.pop_back();
+        queued[s] = false;
+
+        int64_t fromLow = mTapeGuards[s] ? 0 : low[s];
+        int64_t fromHigh = mTapeGuards[s] ? 0 : high[s];
+        vector<Rule *> &rules = mStateRules[s];
+        for (vector<Rule *>::iterator i = rules.begin();
+             i != rules.end();
              i++)
         {
-            masm.link(*i, masm.label());
+            int to = (*i)->getToState();
+            if (mTapeGuards[to] || to == mMachine->getHaltState())
+                continue;
+
+            int64_t toLow = min(low[to], fromLow + (*i)->getDelta());
+            int64_t toHigh = max(high[to], fromHigh + (*i)->getDelta());
+            if (toLow == low[to] && toHigh == high[to])
+                continue;
+
+            low[to] = toLow;
+            high[to] = toHigh;
+            if (toLow < -GUARD_SLACK || toHigh > GUARD_SLACK)
+                mTapeGuards[to] = true;
+            if (!queued[to]) {
+                queued[to] = true;
+                work.push_back(to);
+            }
         }
-        nextRuleJumps.clear();
+    }
+}
 
-        // Emit guards
-        vector<Pattern *> *condition = rule->getCondition();
-        for (vector<Pattern *>::iterator i = condition->begin();
-             i != condition->end();
-             i++)
+// Compile every state reachable from the initial state before running
+// anything, emitting into separate buffers on worker threads. The code is
+// then copied into place, in the order layOutStates() chose, and every
+// transition linked directly.
+void JIT::compileAll()
+{
+    int threads = max(1, min(mCompileThreads, (int)mEagerStates.size()));
+    if (mTraceLevel >= TRACE_COMPILE)
+        printf("Compiling %d states on %d threads\n",
+               (int)mEagerStates.size(), threads);
+
+    mEagerCode.assign(mStateCount, vector<unsigned char>());
+    mEagerRelocations.assign(mStateCount, vector<MASM::Relocation>());
+    mNextEagerState = 0;
+    vector<pthread_t> workers(threads - 1);
+    for (unsigned int i = 0; i < workers.size(); i++) {
+        if (pthread_create(&workers[i], 0, CompileWorker, this))
+            errx(1, "Unable to start compiler thread");
+    }
+    compileWorker();
+    for (unsigned int i = 0; i < workers.size(); i++)
+        pthread_join(workers[i], 0);
+
+    // The states are placed back to back, making one image
+    char *imageEnd = 0;
+    for (vector<int>::iterator i = mEagerStates.begin();
+         i != mEagerStates.end();
+         i++)
+    {
+        vector<unsigned char> &code = mEagerCode[*i];
+        size_t available;
+        void *buffer = mCode.getBuffer(code.size(), &available);
+        memcpy(mCode.getWritable(buffer), &code[0], code.size());
+        mStateArray[*i] = mCode.commit(code.size());
+        relocate(mStateArray[*i], mEagerRelocations[*i]);
+        recordCode(mStateArray[*i], code.size(), "state", *i);
+        imageEnd = (char *)mStateArray[*i] + code.size();
+    }
+    for (vector<int>::iterator i = mEagerStates.begin();
+         i != mEagerStates.end();
+         i++)
+    {
+        vector<pair<unsigned int, int> > &sites = mLinkSites[*i];
+        for (vector<pair<unsigned int, int> >::iterator j = sites.begin();
+             j != sites.end();
+             j++)
         {
-            Pattern *pat = *i;
-            masm.compare8(MASM::Location(MASM::RBX,
-                                         0,
-                                         0,
-                                         pat->getTape()),
-                          pat->getSymbol());
-            MASM::Jump nextRule = masm.jump32(MASM::COND_NOT_EQUAL);
-            nextRuleJumps.push_back(nextRule);
-        }
-
-        // Emit action
-        vector<Pattern *> *action = rule->getAction();
-        for (vector<Pattern *>::iterator i = action->begin();
-             i != action->end();
+            void *site = (char *)mStateArray[*i] + j->first;
+            if (mStateArray[j->second] != mCompilerTrampoline)
+                MASM::relink(site, mStateArray[j->second],
+                             mCode.getWriteOffset());
+        }
+    }
+
+    if (!mCacheDirectory.empty()) {
+        char *image = (char *)mStateArray[mEagerStates[0]];
+        CodeCache cache(mCacheDirectory, getCacheKey());
+        vector<int> &stateOffsets = cache.getStateOffsets();
+        vector<MASM::Relocation> &relocations = cache.getRelocations();
+        stateOffsets.assign(mStateCount, -1);
+        for (vector<int>::iterator i = mEagerStates.begin();
+             i != mEagerStates.end();
              i++)
         {
-            Pattern *pat = *i;
-            masm.store8(MASM::Location(MASM::RBX,
-                                       0,
-                                       0,
-                                       pat->getTape()),
-                        pat->getSymbol());
+            int offset = (char *)mStateArray[*i] - image;
+            stateOffsets[*i] = offset;
+            vector<MASM::Relocation> &own = mEagerRelocations[*i];
+            for (vector<MASM::Relocation>::iterator j = own.begin();
+                 j != own.end();
+                 j++)
+            {
+                int index = j->getIndex();
+                if (j->getSymbol() == MASM::Relocation::LABEL)
+                    index += offset;
+                relocations.push_back(MASM::Relocation(offset + j->getOffset(),
+                                                       j->getSymbol(),
+                                                       index));
+            }
         }
+        cache.getBodyOffsets() = mBodyOffsets;
+        cache.setCode(image, imageEnd - image);
+        cache.save();
+    }
+
+    mEagerCode.clear();
+    mEagerRelocations.clear();
+}
 
-        // Add tape delta
-        masm.add32(MASM::RBX, rule->getDelta() * mTapeCount);
+// Loads the image saved by compileAll() in an earlier run, if there is one
+bool JIT::loadCache()
+{
+    CodeCache cache(mCacheDirectory, getCacheKey());
+    if (!cache.load(mStateCount))
+        return false;
+
+    vector<int> &stateOffsets = cache.getStateOffsets();
 
-        // Jump to next state
-        masm.move64(MASM::RDI, (uint64_t)(&mStateArray[rule->getToState()]));
-        masm.jumpReallyIndirect(MASM::Location(MASM::RDI));
+    // Set up what compiling these states would have
+    for (int i = 0; i < mStateCount; i++) {
+        if (stateOffsets[i] >= 0 && i != mMachine->getHaltState() &&
+            mTraceLevel < TRACE_TAPE)
+        {
+            mScanLoops[i] = ScanLoop::create(i, mStateRules[i], mTapeCount);
+        }
+    }
+    if (!checkRelocations(cache.getRelocations(), cache.getCodeSize())) {
+        warnx("Ignoring code cache with unknown relocations");
+        return false;
     }
+    if (mTraceLevel >= TRACE_COMPILE)
+        printf("Loading states from code cache\n");
 
-    // If we didn't make any matches, die.
-    for (vector<MASM::Jump>::iterator i = nextRuleJumps.begin();
-         i != nextRuleJumps.end();
+    size_t available;
+    void *buffer = mCode.getBuffer(cache.getCodeSize(), &available);
+    memcpy(mCode.getWritable(buffer), cache.getCode(), cache.getCodeSize());
+    char *image = (char *)mCode.commit(cache.getCodeSize());
+    for (int i = 0; i < mStateCount; i++) {
+        if (stateOffsets[i] >= 0)
+            mStateArray[i] = image + stateOffsets[i];
+    }
+    mBodyOffsets = cache.getBodyOffsets();
+    relocate(image, cache.getRelocations());
+
+    // Each state's code runs up to the next one's
+    if (mPerfMap || mStats) {
+        vector<pair<int, int> > order;
+        for (int i = 0; i < mStateCount; i++) {
+            if (stateOffsets[i] >= 0)
+                order.push_back(make_pair(stateOffsets[i], i));
+        }
+        sort(order.begin(), order.end());
+        for (unsigned int i = 0; i < order.size(); i++) {
+            size_t end = i + 1 < order.size() ? order[i + 1].first
+                                              : cache.getCodeSize();
+            recordCode(image + order[i].first, end - order[i].first,
+                       "state", order[i].second);
+            if (mStats)
+                mCodeBytes[order[i].second] = end - order[i].first;
+        }
+    }
+    return true;
+}
+
+// Everything that decides what code compileAll() generates
+uint64_t JIT::getCacheKey()
+{
+    vector<int> fields;
+    fields.push_back(mMachine->getInitState());
+    fields.push_back(mMachine->getHaltState());
+    fields.push_back(mStateCount);
+    fields.push_back(mTapeCount);
+    fields.push_back(mTraceLevel >= TRACE_TAPE);
+    fields.push_back(mTapeKind);
+    fields.push_back(mSuperblockThreshold != 0);
+    fields.push_back(mFuel);
+    fields.push_back(mStats);
+    fields.push_back(mGuardSlack);
+    fields.insert(fields.end(), mFallThrough.begin(), mFallThrough.end());
+    fields.insert(fields.end(), mTapeGuards.begin(), mTapeGuards.end());
+    for (int i = 0; i < mStateCount; i++) {
+        for (vector<Rule *>::iterator j = mStateRules[i].begin();
+             j != mStateRules[i].end();
+             j++)
+        {
+            fields.push_back((*j)->getFromState());
+            fields.push_back((*j)->getToState());
+            fields.push_back((*j)->getDelta());
+
+            Pattern *condition = (*j)->getCondition();
+            fields.push_back((*j)->getConditionSize());
+            for (unsigned int k = 0; k < (*j)->getConditionSize(); k++) {
+                fields.push_back(condition[k].getTape());
+                fields.push_back(condition[k].getSymbol());
+            }
+
+            Pattern *action = (*j)->getAction();
+            fields.push_back((*j)->getActionSize());
+            for (unsigned int k = 0; k < (*j)->getActionSize(); k++) {
+                fields.push_back(action[k].getTape());
+                fields.push_back(action[k].getSymbol());
+            }
+        }
+    }
+
+    return CodeCache::hash(CodeCache::getBuildKey(),
+                           &fields[0], fields.size() * sizeof(int));
+}
+
+// Takes states off the shared list until there are none left. Emitting a
+// state only writes to that state's entries of the JIT's tables.
+void JIT::compileWorker()
+{
+    for (;;) {
+        unsigned int next = __sync_fetch_and_add(&mNextEagerState, 1);
+        if (next >= mEagerStates.size())
+            return;
+
+        int state = mEagerStates[next];
+        uint64_t start = mStats ? Now() : 0;
+        vector<unsigned char> &code = mEagerCode[state];
+        code.resize(EAGER_BUFFER_SIZE);
+        for (;;) {
+            MASM masm(&code[0], code.size());
+            emitState(masm, state);
+            if (!masm.hasOverflowed()) {
+                code.resize(masm.getSize());
+                mEagerRelocations[state] = masm.getRelocations();
+                break;
+            }
+            code.resize(masm.getSize());
+        }
+        if (mStats) {
+            mCompileNanoseconds[state] = Now() - start;
+            mCodeBytes[state] = code.size();
+        }
+    }
+}
+
+// Addresses baked into state code, named so the code can be reused
+uint64_t JIT::resolveSymbol(int symbol, int index)
+{
+    switch (symbol) {
+    case SYMBOL_JIT:
+        return (uint64_t)this;
+    case SYMBOL_STATE_SLOT:
+        return (uint64_t)&mStateArray[index];
+    case SYMBOL_STATE_COUNTER:
+        return (uint64_t)&mStateCounters[index];
+    case SYMBOL_RULE_COUNT:
+        return (uint64_t)&mRuleCounts[index];
+    case SYMBOL_SCAN_LOOP:
+        return (uint64_t)mScanLoops[index];
+    case SYMBOL_COMPILER_TRAMPOLINE:
+        return (uint64_t)mCompilerTrampoline;
+    case SYMBOL_GROW_TRAMPOLINE:
+        return (uint64_t)mGrowTrampoline;
+    case SYMBOL_DEBUG_STUB:
+        return (uint64_t)&DebugStub;
+    case SYMBOL_SCAN_STUB:
+        return (uint64_t)&ScanStub;
+    case SYMBOL_FUEL_SCAN_STUB:
+        return (uint64_t)&FuelScanStub;
+    case SYMBOL_STATE_ENTRIES:
+        return (uint64_t)&mStateEntries[index];
+    case SYMBOL_SUPERBLOCK_STUB:
+        return (uint64_t)&SuperblockStub;
+    }
+    errx(1, "Unknown symbol %d in compiled code", symbol);
+}
+
+void JIT::moveSymbol(MASM &masm, MASM::Register dest, Symbol symbol, int index)
+{
+    masm.move64(dest, resolveSymbol(symbol, index), symbol, index);
+}
+
+// Whether every relocation read back from a cache names something this JIT
+// has, so that resolving them never indexes past its tables
+bool JIT::checkRelocations(vector<MASM::Relocation> &relocations,
+                           size_t codeSize)
+{
+    for (vector<MASM::Relocation>::iterator i = relocations.begin();
+         i != relocations.end();
          i++)
     {
-        masm.link(*i, masm.label());
+        int index = i->getIndex();
+        size_t limit;
+        switch (i->getSymbol()) {
+        case MASM::Relocation::LABEL:
+            limit = codeSize;
+            break;
+        case SYMBOL_STATE_SLOT:
+            limit = mStateCount;
+            break;
+        case SYMBOL_STATE_COUNTER:
+            limit = mStateCounters.size();
+            break;
+        case SYMBOL_RULE_COUNT:
+            limit = mRuleCounts.size();
+            break;
+        case SYMBOL_STATE_ENTRIES:
+            limit = mStateEntries.size();
+            break;
+        case SYMBOL_SCAN_LOOP:
+            if (index < 0 || index >= mStateCount || !mScanLoops[index])
+                return false;
+            continue;
+        case SYMBOL_JIT:
+        case SYMBOL_COMPILER_TRAMPOLINE:
+        case SYMBOL_GROW_TRAMPOLINE:
+        case SYMBOL_DEBUG_STUB:
+        case SYMBOL_SCAN_STUB:
+        case SYMBOL_FUEL_SCAN_STUB:
+        case SYMBOL_SUPERBLOCK_STUB:
+            continue;
+        default:
+            return false;
+        }
+        if (index < 0 || (size_t)index >= limit)
+            return false;
+    }
+    return true;
+}
+
+// Rewrite the relocated immediates of code that now lives at code
+void JIT::relocate(void *code, vector<MASM::Relocation> &relocations)
+{
+    char *writable = (char *)mCode.getWritable(code);
+    for (vector<MASM::Relocation>::iterator i = relocations.begin();
+         i != relocations.end();
+         i++)
+    {
+        uint64_t *immediate = (uint64_t *)(writable + i->getOffset());
+        if (i->getSymbol() == MASM::Relocation::LABEL)
+            *immediate = (uint64_t)((char *)code + i->getIndex());
+        else
+            *immediate = resolveSymbol(i->getSymbol(), i->getIndex());
+    }
+}
+
+void *JIT::linkState(void **stateEntry, void *site, Execution *execution)
+{
+    // Leave cold states to the interpreter, keeping the link stub so we
+    // come back here once they are compiled
+    int state = stateEntry - mStateArray;
+    if (__atomic_load_n(stateEntry, __ATOMIC_ACQUIRE) == mCompilerTrampoline &&
+        mInterpreter && !mInterpreter->isHot(state))
+    {
+        execution->exitState = state;
+        return mExitTrampoline;
     }
-    masm.die();
 
-    return mStateArray[state];
+    // Another thread may have compiled the state since we looked
+    pthread_mutex_lock(&mLock);
+    void *code = *stateEntry;
+    if (code == mCompilerTrampoline)
+        code = compileState(stateEntry);
+
+    // If the target is out of range we just keep going through the stub
+    if (site)
+        MASM::relink(site, code, mCode.getWriteOffset());
+
+    pthread_mutex_unlock(&mLock);
+    return code;
 }
 
-void JIT::buildInitialTrampoline()
+void *JIT::emitCode(Emitter emitter, int state, const char *kind,
+                    size_t *size)
 {
-    Machine *mach = mFunction->getMachine();
+    size_t needed = 0;
+    for (;;) {
+        size_t available;
+        void *buffer = mCode.getBuffer(needed, &available);
+        MASM masm(mCode.getWritable(buffer), available, buffer);
+        (this->*emitter)(masm, state);
+        if (!masm.hasOverflowed()) {
+            void *code = mCode.commit(masm.getSize());
+            recordCode(code, masm.getSize(), kind, state);
+            if (size)
+                *size = masm.getSize();
+            return code;
+        }
+        needed = masm.getSize();
+    }
+}
 
-    mInitialTrampoline = NewBuffer();
-    MASM masm(mInitialTrampoline);
+// Names code for profilers, by function and state if it has one
+void JIT::recordCode(void *code, size_t size, const char *kind, int state)
+{
+    if (!mPerfMap)
+        return;
+
+    char name[64];
+    if (state >= 0)
+        snprintf(name, sizeof(name), " %s %d", kind, state);
+    else
+        snprintf(name, sizeof(name), " %s", kind);
+    mPerfMap->add(code, size, *mFunction->getName() + name);
+}
 
+void JIT::buildInitialTrampoline(MASM &masm, int)
+{
+    // Six pushes keep the stack 16-byte aligned in state code
     masm.push64(MASM::RBX);
+    masm.push64(MASM::RBP);
+    masm.push64(MASM::R12);
+    masm.push64(MASM::R13);
     masm.push64(MASM::R14);
     masm.push64(MASM::R15);
 
+    MASM::Location fuel(MASM::R12, 0, 0, offsetof(Execution, fuel));
     masm.move64(MASM::RBX, MASM::RDI);
     masm.move64(MASM::R14, MASM::RSI);
     masm.move64(MASM::R15, MASM::RDX);
-    masm.move64(MASM::RDI, (uint64_t)(mStateArray + mach->getInitState()));
+    masm.move64(MASM::R12, MASM::R8);
+    masm.load64(MASM::R13, fuel);
+    masm.move64(MASM::RDI, MASM::RCX);
+    masm.move64(MASM::RSI, 0);
     masm.load64(MASM::RAX, MASM::Location(MASM::RDI));
     masm.call(MASM::RAX);
     masm.move64(MASM::RAX, MASM::RBX);
+    masm.store64(fuel, MASM::R13);
 
     masm.pop64(MASM::R15);
     masm.pop64(MASM::R14);
+    masm.pop64(MASM::R13);
+    masm.pop64(MASM::R12);
+    masm.pop64(MASM::RBP);
     masm.pop64(MASM::RBX);
     masm.ret();
 }
 
-void JIT::buildCompilerTrampoline()
+void JIT::buildCompilerTrampoline(MASM &masm, int)
 {
-    mCompilerTrampoline = NewBuffer();
-    MASM masm(mCompilerTrampoline);
-
-    // State address in RDI
-    masm.move64(MASM::RSI, (uint64_t)this);
+    // State address in RDI, jump site to patch (or null) in RSI
+    masm.move64(MASM::RDX, (uint64_t)this);
+    masm.move64(MASM::RCX, MASM::R12);
     masm.move64(MASM::RAX, (uint64_t)&CompilerStub);
     masm.call(MASM::RAX);
     masm.jumpIndirect(MASM::RAX);
 }
 
-void JIT::buildGrowTrampoline()
+void JIT::buildExitTrampoline(MASM &masm, int)
 {
-    mGrowTrampoline = NewBuffer();
-    MASM masm(mGrowTrampoline);
+    // Jumped to from the compiler trampoline with the stack as it was on
+    // entry to the state code, so this returns to the initial trampoline
+    masm.ret();
+}
 
+void JIT::buildGrowTrampoline(MASM &masm, int)
+{
     // tapePtr = GrowStub(tapePtr)
+    masm.push64(MASM::RBP);
     masm.move64(MASM::RDI, MASM::RBX); 
     masm.move64(MASM::RSI, (uint64_t)this);
+    masm.move64(MASM::RDX, MASM::R12);
     masm.move64(MASM::RAX, (uint64_t)&GrowStub);
     masm.call(MASM::RAX);
     masm.move64(MASM::RBX, MASM::RAX);
+    masm.pop64(MASM::RBP);
 
-    // lowerBound = mTape
-    masm.move64(MASM::R14, (uint64_t)&mTape);
-    masm.load64(MASM::R14, MASM::Location(MASM::R14));
-
-    // upperBound = lowerBound + mTapeSize
-    masm.move64(MASM::R15, (uint64_t)&mTapeSize);
-    masm.load64(MASM::R15, MASM::Location(MASM::R15));
-    masm.add64(MASM::R15, MASM::R14);
+    // Reload bounds
+    masm.load64(MASM::R14, MASM::Location(MASM::R12, 0, 0,
+                                          offsetof(Execution, lower)));
+    masm.load64(MASM::R15, MASM::Location(MASM::R12, 0, 0,
+                                          offsetof(Execution, upper)));
 
     masm.ret();
 }
 
-unsigned char *JIT::growTape(unsigned char *tapePtr)
+unsigned char *JIT::growTape(unsigned char *tapePtr, Execution *execution)
 {
-    int offset = tapePtr - mTape;
-    int oldSize = mTapeSize;
-
-    assert(offset >= oldSize);
-
-    printf("Growing tape to size %d.\n", oldSize * 2);
+    tapePtr = execution->tape->grow(tapePtr, GUARD_SLACK);
+    setBounds(*execution);
 
-    // Resize tape
-    mTapeSize = 2 * oldSize;
-    mTape = (unsigned char *) xrealloc(mTape, mTapeSize);
+    if (mTraceLevel >= TRACE_COMPILE)
+        printf("Growing tape to size %d.\n",
+               (int)(execution->tape->getUpperBound() -
+                     execution->tape->getLowerBound()));
 
-    // Clear uninitialized tape cells
-    memset(mTape + oldSize, 0xffu, oldSize);
+    return tapePtr;
+}
 
-    return mTape + offset;
+// The bounds compiled code checks the head against, which leave room for
+// it to move GUARD_SLACK cells past a check either way
+void JIT::setBounds(Execution &execution)
+{
+    execution.lower = execution.tape->getLowerBound() + mGuardSlack;
+    execution.upper = execution.tape->getUpperBound() - mGuardSlack;
 }
 
-void JIT::debugSpam(int state, unsigned char *idx)
+void JIT::debugSpam(int state, unsigned char *idx, Execution *execution)
 {
-    mCycle++;
+    Tape *tape = execution->tape;
+    unsigned int cycle = ++execution->cycle;
 
-    unsigned int index = (idx - mTape) / mTapeCount; 
-    bool final = (state == mFunction->getMachine()->getHaltState());
-    if (index == 0 || final) {
-        printf("--------------------------------------------- Cycle %6d\n", mCycle);
+    int index = (idx - tape->getCell(0)) / mTapeCount; 
+    bool final = (state == mMachine->getHaltState());
+    if (index == 0 || final || mTraceLevel >= TRACE_STEPS) {
+        printf("--------------------------------------------- Cycle %6d\n", cycle);
         printf("State %d%s\n", state, final ? " (final)" : "");
-        for (int tape = 0; tape < mTapeCount; tape++) {
-            printf("Var %3d: ", tape);
-            for (unsigned int cell = 0; cell < mTapeSize / mTapeCount; cell++) {
+        for (int var = 0; var < mTapeCount; var++) {
+            printf("Var %3d: ", var);
+            for (int cell = tape->getFirstCell(); cell < tape->getEndCell(); cell++) {
                 char c;
-                switch (mTape[cell * mTapeCount + tape]) {
+                switch (tape->getCell(cell)[var]) {
                 case 0:
                     c = '0';
                     break;
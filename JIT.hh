@@ -1,37 +1,250 @@
 #ifndef JIT_HH__
 #define JIT_HH__
 
+#include <cstdio>
+#include <pthread.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ExecutableAllocator.hh"
+#include "Execution.hh"
 #include "Function.hh"
+#include "Interpreter.hh"
+#include "MASM.hh"
+#include "PerfMap.hh"
+#include "ScanLoop.hh"
+#include "Tape.hh"
 
 class JIT
 {
 public:
-    JIT(Function *function, unsigned int *params);
+    class Options;
+    enum TraceLevel {
+        TRACE_NONE = 0,
+        TRACE_COMPILE,
+        TRACE_TAPE,
+        TRACE_STEPS
+    };
+
+    JIT(Function *function, const Options &options);
+    ~JIT();
 
-    int run();
+    int getTapeCount();
+    size_t getCodeSize();
+    Tape *createTape(int cells);
+    void start(Execution &execution);
+    bool resume(Execution &execution);
+    bool isHalted(Execution &execution);
+    void writeStats(FILE *out, bool json);
+    void writeProfile(const std::string &path);
+
+    void *compile(int state);
     void *compileState(void **stateEntry);
-    unsigned char *growTape(unsigned char *idx);
-    void debugSpam(int state, unsigned char *idx);
+    void *linkState(void **stateEntry, void *site, Execution *execution);
+    void compileWorker();
+    unsigned char *growTape(unsigned char *idx, Execution *execution);
+    void debugSpam(int state, unsigned char *idx, Execution *execution);
+    void formSuperblock(int state);
 
 private:
+    typedef void (JIT::*Emitter)(MASM &masm, int state);
+
+    // Relocation symbols; MASM::Relocation::LABEL is zero
+    enum Symbol {
+        SYMBOL_JIT = 1,
+        SYMBOL_STATE_SLOT,
+        SYMBOL_STATE_COUNTER,
+        SYMBOL_RULE_COUNT,
+        SYMBOL_SCAN_LOOP,
+        SYMBOL_COMPILER_TRAMPOLINE,
+        SYMBOL_GROW_TRAMPOLINE,
+        SYMBOL_DEBUG_STUB,
+        SYMBOL_SCAN_STUB,
+        SYMBOL_FUEL_SCAN_STUB,
+        SYMBOL_SUPERBLOCK_STUB,
+        SYMBOL_STATE_ENTRIES
+    };
+
+    static const unsigned int MAX_SUPERBLOCK_LENGTH = 16;
+    static const unsigned int EAGER_BUFFER_SIZE = 4096;
+    static const int GUARD_SLACK = 16;
+
     Function *mFunction;
-    unsigned int *mParameters;
+    Machine *mMachine;
+    TraceLevel mTraceLevel;
+    Tape::Kind mTapeKind;
+    int mTapeGrowthFactor;
+    bool mTapeRecenter;
+    unsigned int mSuperblockThreshold;
+    unsigned int mTierUpThreshold;
+    bool mInterpretOnly;
+    bool mEager;
+    int mCompileThreads;
+    std::string mCacheDirectory;
+    bool mFuel;
+    bool mStats;
+    PerfMap *mPerfMap;
     void **mStateArray;
+    std::vector<std::vector<Rule *> > mStateRules;
+    std::vector<ScanLoop *> mScanLoops;
     int mStateCount;
     int mTapeCount;
-    int mParameterCount;
 
+    // Held while compiling, linking or forming superblocks, so one thread
+    // compiles each state while the rest run code already published
+    pthread_mutex_t mLock;
+
+    ExecutableAllocator mCode;
     void *mInitialTrampoline;
     void *mCompilerTrampoline;
     void *mGrowTrampoline;
+    void *mExitTrampoline;
+
+    Interpreter *mInterpreter;
+
+    // Superblock profiling. Counters count down to formation; the counts
+    // for a state's rules start at mFirstRules[state], in mStateRules order.
+    // States whose superblock couldn't be linked in never get another.
+    std::vector<uint32_t> mStateCounters;
+    std::vector<bool> mSuperblockFailed;
+    std::vector<int> mFirstRules;
+    std::vector<uint64_t> mRuleCounts;
+    std::vector<unsigned int> mBodyOffsets;
+    std::vector<std::pair<int, int> > mSuperblockPath;
+
+    // On a checked tape, compiled code checks the head against bounds
+    // pulled in by mGuardSlack bytes, GUARD_SLACK cells, so that it can
+    // move that far past a check before it needs another. States that
+    // can't be entered further than that from the last check, per
+    // findTapeGuards(), go without one: mTapeGuards[state] is false.
+    std::vector<bool> mTapeGuards;
+    int mGuardSlack;
+
+    // Statistics, kept with Options::stats. Rule hits are in mRuleCounts.
+    // Counts are best effort when threads share the JIT.
+    std::vector<uint64_t> mStateEntries;
+    std::vector<uint64_t> mCompileNanoseconds;
+    std::vector<unsigned int> mCodeBytes;
+    std::vector<unsigned int> mSuperblockBytes;
+    uint64_t mTapeGrows;
+
+    // Rule hits from Options::profile, indexed like mRuleCounts; empty
+    // without one
+    std::vector<uint64_t> mProfileCounts;
+
+    // Eager compilation. Each state's code is emitted into its own buffer
+    // and copied into place once all are done. Link sites are offsets of
+    // transitions into the state's code, with their target states.
+    std::vector<int> mEagerStates;
+    unsigned int mNextEagerState;
+    std::vector<std::vector<unsigned char> > mEagerCode;
+    std::vector<std::vector<MASM::Relocation> > mEagerRelocations;
+    std::vector<std::vector<std::pair<unsigned int, int> > > mLinkSites;
+
+    // With a profile, states are laid out so that each state's hottest
+    // rule, mFallThrough[state] or -1 for none, runs straight on into its
+    // next state's code
+    std::vector<int> mFallThrough;
+
+    void doFormSuperblock(int state);
+    void *emitCode(Emitter emitter, int state, const char *kind,
+                   size_t *size = 0);
+    void recordCode(void *code, size_t size, const char *kind, int state);
+    void orderRules(std::vector<Rule *> &rules, std::vector<uint64_t> &hits);
+    void layOutStates();
+    void findTapeGuards();
+    void setBounds(Execution &execution);
+    void compileAll();
+    bool loadCache();
+    uint64_t getCacheKey();
+    void emitState(MASM &masm, int state);
+    void emitSuperblock(MASM &masm, int state);
+    void emitAction(MASM &masm,
+                    int state,
+                    int rule,
+                    std::vector<MASM::Jump> &actionJumps,
+                    bool count,
+                    bool fallThrough,
+                    std::vector<std::pair<MASM::Jump, int> > &nextStateJumps);
+    MASM::Label emitTapeGuards(MASM &masm, std::vector<MASM::Jump> &grows);
+    void emitGrowStub(MASM &masm, std::vector<MASM::Jump> &grows,
+                      MASM::Label guards);
+    MASM::Jump emitFuelCheck(MASM &masm, int units = 1);
+    void emitYield(MASM &masm, MASM::Jump outOfFuel, int state);
+    void moveSymbol(MASM &masm, MASM::Register dest, Symbol symbol,
+                    int index = 0);
+    uint64_t resolveSymbol(int symbol, int index);
+    bool checkRelocations(std::vector<MASM::Relocation> &relocations,
+                          size_t codeSize);
+    void relocate(void *code, std::vector<MASM::Relocation> &relocations);
+    void emitStateJump(MASM &masm,
+                       MASM::Jump jump,
+                       int to,
+                       std::vector<std::pair<MASM::Jump, int> > &stubs);
+    void emitLinkStubs(MASM &masm,
+                       std::vector<std::pair<MASM::Jump, int> > &stubs);
+
+    void buildInitialTrampoline(MASM &masm, int);
+    void buildCompilerTrampoline(MASM &masm, int);
+    void buildGrowTrampoline(MASM &masm, int);
+    void buildExitTrampoline(MASM &masm, int);
+};
+
+class JIT::Options
+{
+public:
+    Options();
+
+    // TRACE_NONE and TRACE_COMPILE emit no tracing code at all
+    TraceLevel traceLevel;
+    Tape::Kind tapeKind;
+    int tapeGrowthFactor;
+    bool tapeRecenter;
+
+    // States entered this many times are compiled again along with their
+    // hottest successors as one superblock; zero disables this
+    unsigned int superblockThreshold;
+
+    // States are interpreted until entered this many times, then compiled;
+    // zero compiles every state on first entry
+    unsigned int tierUpThreshold;
+    bool interpretOnly;
+
+    // Compile all reachable states up front, on this many threads
+    bool eager;
+    int compileThreads;
+
+    // Keep eagerly compiled code in this directory between runs
+    std::string cacheDirectory;
+
+    // Have compiled code count state entries against the execution's fuel,
+    // so runs can be stopped and resumed; the interpreter always does. A
+    // step limit implies this. One unit of fuel, and one step, is one
+    // entry to a state other than the halting one. Superblocks and scans
+    // take one for each entry they stand in for, so every mode stops after
+    // the same steps.
+    bool fuel;
+    uint64_t stepLimit;
+
+    // Name generated code for perf in /tmp/perf-<pid>.map, and if jitdump
+    // also in a jitdump file with a copy of the code
+    bool perfMap;
+    bool jitdump;
+
+    // Count state entries and rule hits inline in compiled code, and time
+    // compiles, for writeStats()
+    bool stats;
 
-    unsigned char *mTape;
-    unsigned int mTapeSize;
-    unsigned int mCycle;
+    // Order each state's rules by the hits in this profile, where that
+    // can't change which rule matches, and lay out eagerly compiled states
+    // so hot transitions fall through
+    std::string profile;
 
-    void buildInitialTrampoline();
-    void buildCompilerTrampoline();
-    void buildGrowTrampoline();
+    // Compile the machine as rewritten by the Optimizer, rather than as
+    // given
+    bool optimize;
 };
 
 #endif
@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <assert.h>
 
 #include "MASM.hh"
 
+using namespace std;
+
 MASM::Register MASM::REG_NONE(0);
 MASM::Register MASM::RAX(0);
 MASM::Register MASM::RCX(1);
@@ -20,9 +23,13 @@ MASM::Register MASM::R13(13);
 MASM::Register MASM::R14(14);
 MASM::Register MASM::R15(15);
 
-MASM::MASM(void *buffer)
+// Code is written to buffer but will run at address, if given; the two
+// differ when the code space is mapped twice.
+MASM::MASM(void *buffer, unsigned int size, void *address)
 {
     mBase = mPointer = buffer;
+    mAddress = (char *)(address ? address : buffer);
+    mLimit = (char *)buffer + size;
 }
 
 MASM::Label MASM::label()
@@ -30,6 +37,18 @@ MASM::Label MASM::label()
     return Label((char *)mPointer - (char *)mBase);
 }
 
+unsigned int MASM::getSize()
+{
+    return (char *)mPointer - (char *)mBase;
+}
+
+// Once the buffer is full we keep counting bytes without writing them, so
+// the caller can find out how big a buffer it should retry with.
+bool MASM::hasOverflowed()
+{
+    return mPointer > mLimit;
+}
+
 void MASM::move64(Register dest, uint64_t immed)
 {
     uint8_t r = dest.getNumber();
@@ -38,6 +57,22 @@ void MASM::move64(Register dest, uint64_t immed)
     write64(immed);
 }
 
+// Absolute address of a label in this code, recorded as a relocation in
+// case the code is copied elsewhere
+void MASM::move64(Register dest, Label label)
+{
+    move64(dest, (uint64_t)getAddress(label),
+           Relocation::LABEL, label.getOffset());
+}
+
+// An immediate standing for the given symbol, recorded as a relocation
+void MASM::move64(Register dest, uint64_t immediate, int symbol, int index)
+{
+    move64(dest, immediate);
+    mRelocations.push_back(Relocation(getSize() - sizeof(uint64_t),
+                                      symbol, index));
+}
+
 void MASM::move64(Register dest, Register src)
 {
     doREX(src, dest, true);
@@ -56,11 +91,17 @@ void MASM::compare8(Location where, uint8_t value)
     doREX(Register(7), where, false);
     write8(0x80u);
     doModRMSIB(Register(7), where);
-    if (where.getOffset())
-        write32(where.getOffset()); // FIXME:
     write8(value);
 }
 
+void MASM::compare32(Register a, uint32_t value)
+{
+    doREX(REG_NONE, a, false);
+    write8(0x81u);
+    doModRM(Register(7), a);
+    write32(value);
+}
+
 void MASM::compare64(Register a, Register b)
 {
     doREX(b, a, true);
@@ -68,12 +109,34 @@ void MASM::compare64(Register a, Register b)
     doModRM(b, a);
 }
 
+void MASM::load8ZeroExtend(Register dest, Location source)
+{
+    doREX(dest, source, false);
+    write8(0x0Fu);
+    write8(0xB6u);
+    doModRMSIB(dest, source);
+}
+
+void MASM::load16ZeroExtend(Register dest, Location source)
+{
+    doREX(dest, source, false);
+    write8(0x0Fu);
+    write8(0xB7u);
+    doModRMSIB(dest, source);
+}
+
+void MASM::load32(Register dest, Location source)
+{
+    doREX(dest, source, false);
+    write8(0x8Bu);
+    doModRMSIB(dest, source);
+}
+
 void MASM::load64(Register dest, Location source)
 {
     doREX(dest, source, true);
     write8(0x8Bu);
     doModRMSIB(dest, source);
-    assert(!source.getOffset());
 }
 
 void MASM::store8(Location where, uint8_t value)
@@ -81,11 +144,49 @@ void MASM::store8(Location where, uint8_t value)
     doREX(REG_NONE, where, false, true);
     write8(0xC6u);
     doModRMSIB(REG_NONE, where);
-    if (where.getOffset())
-        write32(where.getOffset()); // FIXME:
     write8(value);
 }
 
+void MASM::store16(Location where, uint16_t value)
+{
+    write8(0x66u);
+    doREX(REG_NONE, where, false);
+    write8(0xC7u);
+    doModRMSIB(REG_NONE, where);
+    write8(value & 0xFF);
+    write8(value >> 8);
+}
+
+void MASM::store16(Location where, Register from)
+{
+    write8(0x66u);
+    doREX(from, where, false);
+    write8(0x89u);
+    doModRMSIB(from, where);
+}
+
+void MASM::store32(Location where, uint32_t value)
+{
+    doREX(REG_NONE, where, false);
+    write8(0xC7u);
+    doModRMSIB(REG_NONE, where);
+    write32(value);
+}
+
+void MASM::store32(Location where, Register from)
+{
+    doREX(from, where, false);
+    write8(0x89u);
+    doModRMSIB(from, where);
+}
+
+void MASM::store64(Location where, Register from)
+{
+    doREX(from, where, true);
+    write8(0x89u);
+    doModRMSIB(from, where);
+}
+
 void MASM::push64(Register from)
 {
     doREX(REG_NONE, from, false);
@@ -118,6 +219,16 @@ MASM::Jump MASM::jump32(Condition cond)
     return Jump(relativeTo, offsetBase);
 }
 
+// A jump that may be relinked while other threads run it: pads with nops so
+// the rel32 is 4-byte aligned, assuming the code itself is at least 4-byte
+// aligned.
+MASM::Jump MASM::patchableJump32()
+{
+    while ((getSize() + 1) % 4)
+        write8(0x90);
+    return jump32();
+}
+
 void MASM::jumpIndirect(Register reg)
 {
     doREX(REG_NONE, reg, false);
@@ -130,12 +241,11 @@ void MASM::jumpReallyIndirect(Location where)
     doREX(REG_NONE, where, false);
     write8(0xFFu);
     doModRMSIB(Register(4), where);
-    assert(!where.getOffset());
 }
 
 void MASM::add32(Register dest, uint32_t imm)
 {
-    doREX(0, 0, dest.getNumber(), true);
+    doREX(REG_NONE, dest, true);
     write8(0x81u);
     doModRM(REG_NONE, dest);
     write32(imm);
@@ -148,6 +258,69 @@ void MASM::add64(Register dest, Register source)
     doModRM(dest, source);
 }
 
+void MASM::loadAddress(Register dest, Location source)
+{
+    doREX(dest, source, true);
+    write8(0x8Du);
+    doModRMSIB(dest, source);
+}
+
+// RIP-relative LEA, linked like a jump
+MASM::Jump MASM::loadAddress(Register dest)
+{
+    doREX(dest, REG_NONE, true);
+    write8(0x8Du);
+    doModRM(MOD_DEREF, dest.getNumber(), 5);
+    unsigned int offsetBase = (char *)mPointer - (char *)mBase;
+    write32(0);
+    unsigned int relativeTo = (char *)mPointer - (char *)mBase;
+    return Jump(relativeTo, offsetBase);
+}
+
+void MASM::and32(Register dest, uint32_t imm)
+{
+    doREX(REG_NONE, dest, false);
+    write8(0x81u);
+    doModRM(Register(4), dest);
+    write32(imm);
+}
+
+void MASM::and64(Register dest, Register source)
+{
+    doREX(dest, source, true);
+    write8(0x23u);
+    doModRM(dest, source);
+}
+
+void MASM::or32(Register dest, uint32_t imm)
+{
+    doREX(REG_NONE, dest, false);
+    write8(0x81u);
+    doModRM(Register(1), dest);
+    write32(imm);
+}
+
+void MASM::or64(Register dest, Register source)
+{
+    doREX(dest, source, true);
+    write8(0x0Bu);
+    doModRM(dest, source);
+}
+
+void MASM::increment64(Location where)
+{
+    doREX(REG_NONE, where, true);
+    write8(0xFFu);
+    doModRMSIB(REG_NONE, where);
+}
+
+void MASM::decrement32(Location where)
+{
+    doREX(Register(1), where, false);
+    write8(0xFFu);
+    doModRMSIB(Register(1), where);
+}
+
 void MASM::ret()
 {
     write8(0xC3u);
@@ -158,14 +331,87 @@ void MASM::die()
     write8(0xCCu);
 }
 
+// Pads with the longest nops there are, so running through the padding
+// costs as few instructions as it can
+void MASM::align(unsigned int boundary)
+{
+    static const uint8_t nops[9][9] = {
+        { 0x90 },
+        { 0x66, 0x90 },
+        { 0x0F, 0x1F, 0x00 },
+        { 0x0F, 0x1F, 0x40, 0x00 },
+        { 0x0F, 0x1F, 0x44, 0x00, 0x00 },
+        { 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00 },
+        { 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00 },
+        { 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 }
+    };
+
+    while (getSize() % boundary) {
+        unsigned int length = min(boundary - getSize() % boundary, 9u);
+        for (unsigned int i = 0; i < length; i++)
+            write8(nops[length - 1][i]);
+    }
+}
+
 void MASM::link(Jump j, Label l)
 {
+    if (j.getRelativeBase() > (char *)mLimit - (char *)mBase)
+        return;
     int offset = l.getOffset() - j.getRelativeBase();
     *((int *)((char *)mBase + j.getOffsetBase())) = offset;
 }
 
+bool MASM::link(Jump j, void *to)
+{
+    if (j.getRelativeBase() > (char *)mLimit - (char *)mBase)
+        return true;
+    return relink(getSite(j), to, (char *)mBase - mAddress);
+}
+
+// Points the jump whose rel32 runs at site to the given target. The rel32
+// itself is written at site + writeOffset. A patchable jump's rel32 never
+// straddles a cache line, so this store is atomic with respect to other
+// threads executing the jump.
+bool MASM::relink(void *site, void *to, ptrdiff_t writeOffset)
+{
+    int64_t offset = (char *)to - ((char *)site + 4);
+    if (offset != (int32_t)offset)
+        return false;
+    __atomic_store_n((int32_t *)((char *)site + writeOffset), (int32_t)offset,
+                     __ATOMIC_RELEASE);
+    return true;
+}
+
+void *MASM::getAddress(Label l)
+{
+    return mAddress + l.getOffset();
+}
+
+void *MASM::getSite(Jump j)
+{
+    return mAddress + j.getOffsetBase();
+}
+
+vector<MASM::Relocation> &MASM::getRelocations()
+{
+    return mRelocations;
+}
+
+bool MASM::reserve(unsigned int bytes)
+{
+    char *end = (char *)mPointer + bytes;
+    if (end > mLimit) {
+        mPointer = end;
+        return false;
+    }
+    return true;
+}
+
 void MASM::write8(uint8_t byte)
 {
+    if (!reserve(1))
+        return;
     uint8_t *ptr = (uint8_t *)mPointer;
     *(ptr++) = byte;
     mPointer = ptr;
@@ -173,6 +419,8 @@ void MASM::write8(uint8_t byte)
 
 void MASM::write32(uint32_t dword)
 {
+    if (!reserve(4))
+        return;
     uint32_t *ptr = (uint32_t *)mPointer;
     *(ptr++) = dword;
     mPointer = ptr;
@@ -180,6 +428,8 @@ void MASM::write32(uint32_t dword)
 
 void MASM::write64(uint64_t qword)
 {
+    if (!reserve(8))
+        return;
     uint64_t *ptr = (uint64_t *)mPointer;
     *(ptr++) = qword;
     mPointer = ptr;
@@ -197,10 +447,13 @@ void MASM::doModRM(Register rr, Register rmr)
 void MASM::doModRMSIB(Register rr, Location rml)
 {
     uint8_t mod = MOD_DEREF;
-    if (rml.getOffset() != 0)
-        mod = MOD_DEREFPLUS32;
     uint8_t r = rr.getNumber();
     uint8_t b = rml.getBase().getNumber();
+
+    // A base of RBP or R13 with no displacement would mean RIP-relative or
+    // no base at all, so give it a zero displacement
+    if (rml.getOffset() != 0 || (b & 0x7) == 5)
+        mod = MOD_DEREFPLUS32;
     if (rml.getMultiplier() > 0) {
         uint8_t s;
         switch (rml.getMultiplier()) {
@@ -221,11 +474,17 @@ void MASM::doModRMSIB(Register rr, Location rml)
         }
         uint8_t i = rml.getOffsetReg().getNumber();
 
-        doModRM(mod, r, 3);
+        doModRM(mod, r, 4);
         doSIB(s, i, b);
+    } else if ((b & 0x7) == 4) {
+        // RSP and R12 as a base need a SIB byte, with no index
+        doModRM(mod, r, 4);
+        doSIB(SS_MULT1, 4, b);
     } else {
         doModRM(mod, r, b);
     }
+    if (mod == MOD_DEREFPLUS32)
+        write32(rml.getOffset());
 }
 
 void MASM::doModRM(uint8_t mod, uint8_t r, uint8_t rm)
@@ -298,6 +557,28 @@ unsigned int MASM::Label::getOffset()
     return mOffset;
 }
 
+MASM::Relocation::Relocation(unsigned int offset, int symbol, int index) :
+    mOffset(offset),
+    mSymbol(symbol),
+    mIndex(index)
+{
+}
+
+unsigned int MASM::Relocation::getOffset()
+{
+    return mOffset;
+}
+
+int MASM::Relocation::getSymbol()
+{
+    return mSymbol;
+}
+
+int MASM::Relocation::getIndex()
+{
+    return mIndex;
+}
+
 MASM::Register::Register(unsigned int num) :
     mNumber(num)
 {
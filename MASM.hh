@@ -1,7 +1,9 @@
 #ifndef MASM_HH__
 #define MASM_HH__
 
+#include <stddef.h>
 #include <stdint.h>
+#include <vector>
 
 class MASM
 {
@@ -10,6 +12,7 @@ public:
     class Label;
     class Location;
     class Register;
+    class Relocation;
     enum Condition {
         COND_OVERFLOW = 0,
         COND_NOT_OVERFLOW,
@@ -47,36 +50,65 @@ public:
     static Register R14;
     static Register R15;
 
-    MASM(void *buffer);
+    MASM(void *buffer, unsigned int size, void *address = 0);
 
     Label label();
+    unsigned int getSize();
+    bool hasOverflowed();
 
     void move64(Register dest, uint64_t immediate);
     void move64(Register dest, Register source);
+    void move64(Register dest, Label label);
+    void move64(Register dest, uint64_t immediate, int symbol, int index);
 
     void call(Register reg);
 
     void add32(Register dest, uint32_t imm);
     void add64(Register dest, Register source);
+    void and32(Register dest, uint32_t imm);
+    void and64(Register dest, Register source);
+    void or32(Register dest, uint32_t imm);
+    void or64(Register dest, Register source);
+    void increment64(Location where);
+    void decrement32(Location where);
 
     void ret();
 
     void compare8(Location where, uint8_t value);
+    void compare32(Register a, uint32_t value);
     void compare64(Register a, Register b);
 
+    void load8ZeroExtend(Register dest, Location source);
+    void load16ZeroExtend(Register dest, Location source);
+    void load32(Register dest, Location source);
     void load64(Register dest, Location source);
+    void loadAddress(Register dest, Location source);
+    Jump loadAddress(Register dest);
     void store8(Location where, uint8_t value);
+    void store16(Location where, uint16_t value);
+    void store16(Location where, Register from);
+    void store32(Location where, uint32_t value);
+    void store32(Location where, Register from);
+    void store64(Location where, Register from);
     void push64(Register from);
     void pop64(Register to);
 
     Jump jump32();
     Jump jump32(Condition cond);
+    Jump patchableJump32();
     void jumpIndirect(Register where);
     void jumpReallyIndirect(Location where);
 
     void die();
+    void align(unsigned int boundary);
 
     void link(Jump jump, Label to);
+    bool link(Jump jump, void *to);
+    static bool relink(void *site, void *to, ptrdiff_t writeOffset = 0);
+
+    void *getAddress(Label label);
+    void *getSite(Jump jump);
+    std::vector<Relocation> &getRelocations();
 
 private:
     static const uint8_t MOD_DEREF = 0;
@@ -91,7 +123,12 @@ private:
     static const uint8_t REG_NO_REX_MAX = 7;
 
     void *mBase;
+    char *mAddress;
     void *mPointer;
+    void *mLimit;
+    std::vector<Relocation> mRelocations;
+
+    bool reserve(unsigned int bytes);
 
     void write8(uint8_t byte);
     void write32(uint32_t dword);
@@ -143,6 +180,28 @@ private:
     unsigned int mOffset;
 };
 
+/*
+ * A 64-bit immediate at offset that holds the address of something that
+ * may be elsewhere when the code is reused: a label in the same code, with
+ * index its offset, or a symbol defined by the user of the assembler.
+ */
+class MASM::Relocation
+{
+public:
+    static const int LABEL = 0;
+
+    Relocation(unsigned int offset, int symbol, int index);
+
+    unsigned int getOffset();
+    int getSymbol();
+    int getIndex();
+
+private:
+    unsigned int mOffset;
+    int mSymbol;
+    int mIndex;
+};
+
 class MASM::Location
 {
 public:
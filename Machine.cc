@@ -1,13 +1,56 @@
+#include <algorithm>
+#include <assert.h>
+
 #include "Machine.hh"
 
 using namespace std;
 
-Machine::Machine(int init, int halt, vector<Rule *> &rules) :
+Machine::Machine(int init, int halt, vector<Pattern> &patterns,
+                 vector<RuleSpec> &rules) :
     mInitState(init),
     mHaltState(halt),
-    mRules(rules)
+    mStateCount(max(init, halt) + 1),
+    mTapeCount(0)
 {
+    mPatterns.swap(patterns);
+    for (vector<Pattern>::iterator i = mPatterns.begin();
+         i != mPatterns.end();
+         i++)
+    {
+        mTapeCount = max(mTapeCount, i->getTape() + 1);
+    }
+    for (vector<RuleSpec>::iterator i = rules.begin(); i != rules.end(); i++) {
+        assert(i->fromState >= 0 && i->toState >= 0);
+        mStateCount = max(mStateCount, i->fromState + 1);
+        mStateCount = max(mStateCount, i->toState + 1);
+    }
+
+    // Count each state's rules, then place them
+    mFirstRules.assign(mStateCount + 1, 0);
+    for (vector<RuleSpec>::iterator i = rules.begin(); i != rules.end(); i++)
+        mFirstRules[i->fromState + 1]++;
+    for (int s = 0; s < mStateCount; s++)
+        mFirstRules[s + 1] += mFirstRules[s];
+
+    vector<unsigned int> order(rules.size());
+    vector<unsigned int> next(mFirstRules.begin(), mFirstRules.end() - 1);
+    for (unsigned int i = 0; i < rules.size(); i++)
+        order[next[rules[i].fromState]++] = i;
 
+    Pattern *base = mPatterns.empty() ? 0 : &mPatterns[0];
+    mRules.reserve(rules.size());
+    for (vector<unsigned int>::iterator i = order.begin();
+         i != order.end();
+         i++)
+    {
+        RuleSpec &spec = rules[*i];
+        assert(spec.firstCondition + spec.conditionSize <= mPatterns.size());
+        assert(spec.firstAction + spec.actionSize <= mPatterns.size());
+        mRules.push_back(Rule(spec.fromState, spec.toState,
+                              base + spec.firstCondition, spec.conditionSize,
+                              base + spec.firstAction, spec.actionSize,
+                              spec.delta));
+    }
 }
 
 int Machine::getInitState()
@@ -20,7 +63,34 @@ int Machine::getHaltState()
     return mHaltState;
 }
 
-vector<Rule *> *Machine::getRules()
+int Machine::getStateCount()
+{
+    return mStateCount;
+}
+
+int Machine::getTapeCount()
+{
+    return mTapeCount;
+}
+
+Rule *Machine::getRules()
+{
+    return mRules.empty() ? 0 : &mRules[0];
+}
+
+unsigned int Machine::getRuleCount()
+{
+    return mRules.size();
+}
+
+Rule *Machine::getStateRules(int state)
+{
+    assert(0 <= state && state < mStateCount);
+    return getRules() + mFirstRules[state];
+}
+
+unsigned int Machine::getStateRuleCount(int state)
 {
-    return &mRules;
+    assert(0 <= state && state < mStateCount);
+    return mFirstRules[state + 1] - mFirstRules[state];
 }
@@ -3,22 +3,59 @@
 
 #include <vector>
 
+#include "Pattern.hh"
 #include "Rule.hh"
 
+/*
+ * The rules of a machine, stored flat. They are grouped by the state they
+ * leave, keeping the order they were given in within each state, so each
+ * state's rules are one run of the array; rules are numbered by their place
+ * in it. The patterns of every rule are in one array too.
+ */
 class Machine
 {
 public:
-    Machine(int start, int halt, std::vector<Rule *> &rules);
+    class RuleSpec;
+
+    // Takes the patterns over, leaving the vector given empty
+    Machine(int start, int halt, std::vector<Pattern> &patterns,
+            std::vector<RuleSpec> &rules);
 
     int getInitState();
     int getHaltState();
-    std::vector<Rule *> *getRules();
+
+    // One past the highest state and tape named anywhere
+    int getStateCount();
+    int getTapeCount();
+
+    Rule *getRules();
+    unsigned int getRuleCount();
+    Rule *getStateRules(int state);
+    unsigned int getStateRuleCount(int state);
 
 private:
     int mInitState;
     int mHaltState;
-    std::vector<Rule *> mRules;
+    int mStateCount;
+    int mTapeCount;
+    std::vector<Pattern> mPatterns;
+    std::vector<Rule> mRules;
+    std::vector<unsigned int> mFirstRules;
 
 };
 
+// A rule as machines are built from, naming its patterns by their place in
+// the list given with it
+class Machine::RuleSpec
+{
+public:
+    int fromState;
+    int toState;
+    int delta;
+    unsigned int firstCondition;
+    unsigned int conditionSize;
+    unsigned int firstAction;
+    unsigned int actionSize;
+};
+
 #endif
@@ -1,72 +1,361 @@
+#include <cctype>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <err.h>
 #include <fcntl.h>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
+#include <vector>
 
+#include "BatchRunner.hh"
+#include "CompiledFunction.hh"
 #include "Parser.hh"
 #include "JIT.hh"
+#include "Model.hh"
+#include "Scheduler.hh"
 #include "xmalloc.h"
 
 #define INITIAL_BUF 64
+#define BATCH_BLOCK 65536
 
 using namespace std;
 
-static char *readfile(const char *filename)
+// Maps the file in for the parser to read in place. Files that can't be
+// mapped, such as pipes, are read into a buffer to free() instead.
+static const char *mapfile(const char *filename, size_t *length, bool *mapped)
 {
     int fd = open(filename, O_RDONLY);
     if (fd < 0)
         err(1, "Failed to open file '%s'", filename);
 
+    struct stat st;
+    if (fstat(fd, &st) < 0)
+        err(1, "Failed to stat file '%s'", filename);
+
+    *length = st.st_size;
+    *mapped = false;
+    if (S_ISREG(st.st_mode) && *length > 0) {
+        void *data = mmap(NULL, *length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            close(fd);
+            *mapped = true;
+            return static_cast<const char *>(data);
+        }
+    }
+
     size_t size = INITIAL_BUF;
     size_t count = 0;
     char *buf = static_cast<char *>(xmalloc(size));
     int error;
-    while ((error = read(fd, buf + count, size - 1 - count)) > 0) {
+    while ((error = read(fd, buf + count, size - count)) > 0) {
         count += error;
-        if (count == size - 1) {
+        if (count == size) {
             size *= 2;
             buf = static_cast<char *>(xrealloc(buf, size));
         }
     }
     if (error < 0)
         err(1, "Failed to read file");
+    close(fd);
 
-    buf[count] = '\0';
+    *length = count;
     return buf;
 }
 
+// Calls that ran out of steps have no result and print as a dash
+static void printResults(vector<int> &results, vector<char> &halted,
+                         bool separate)
+{
+    for (unsigned int i = 0; i < results.size(); i++) {
+        if (separate)
+            printf("----------------------------------------------------------\n");
+        if (halted[i])
+            printf("%d\n", results[i]);
+        else
+            printf("-\n");
+    }
+    fflush(stdout);
+}
+
+// Calls the function on each line of parameters in the file, printing
+// one result per line. Blank lines are skipped, unless the function takes
+// no parameters, when every line is a call. With one thread each result
+// is printed as soon as it is ready; with more, or when time-slicing, the
+// lines are shared out a block at a time.
+static void runBatch(CompiledFunction &function, const char *filename,
+                     int threads, uint64_t slice, bool separate)
+{
+    FILE *in = strcmp(filename, "-") ? fopen(filename, "r") : stdin;
+    if (!in)
+        err(1, "Failed to open file '%s'", filename);
+
+    BatchRunner runner(function, threads);
+    Scheduler scheduler(function, threads, slice);
+    unsigned int block = threads > 1 || slice ? BATCH_BLOCK : 1;
+    int arity = function.getArity();
+    vector<unsigned int> params;
+    unsigned int calls = 0;
+    vector<int> results;
+    vector<char> halted;
+    char line[4096];
+    for (int lineNumber = 1; fgets(line, sizeof(line), in); lineNumber++) {
+        char *p = line;
+        int count = 0;
+        for (;;) {
+            while (isspace((unsigned char)*p))
+                p++;
+            if (!*p)
+                break;
+            char *end;
+            unsigned long param = strtoul(p, &end, 0);
+            if (end == p || count == arity)
+                errx(1, "%s:%d: Expected %d arguments", filename, lineNumber,
+                     arity);
+            params.push_back(param);
+            count++;
+            p = end;
+        }
+        if (count == 0 && arity)
+            continue;
+        if (count != arity)
+            errx(1, "%s:%d: Expected %d arguments, got %d", filename,
+                 lineNumber, arity, count);
+
+        if (++calls == block) {
+            if (slice)
+                scheduler.run(params, calls, results, halted);
+            else
+                runner.run(params, calls, results, halted);
+            printResults(results, halted, separate);
+            params.clear();
+            calls = 0;
+        }
+    }
+    if (ferror(in))
+        err(1, "Failed to read file '%s'", filename);
+    if (slice)
+        scheduler.run(params, calls, results, halted);
+    else
+        runner.run(params, calls, results, halted);
+    printResults(results, halted, separate);
+    if (in != stdin)
+        fclose(in);
+}
+
+// Reports the stats counted with -S, -J or -F once the calls are done
+static void writeStats(CompiledFunction &function, bool report,
+                       const char *jsonFile, const char *profileFile)
+{
+    if (report)
+        function.writeStats(stderr, false);
+    if (jsonFile) {
+        FILE *out = strcmp(jsonFile, "-") ? fopen(jsonFile, "w") : stdout;
+        if (!out)
+            err(1, "Failed to open file '%s'", jsonFile);
+        function.writeStats(out, true);
+        if (out != stdout)
+            fclose(out);
+    }
+    if (profileFile)
+        function.writeProfile(profileFile);
+}
+
+static void usage()
+{
+    printf("Usage: tjit [-degInpPS] [-c dir] [-G factor] [-i count] [-j threads]\n"
+           "            [-f profile] [-F profile] [-J file] [-l steps] [-s count]\n"
+           "            [-v...] <in> <func> [params]\n"
+           "       tjit [options] [-q steps] [-t threads] -b <params file> <in> <func>\n"
+           "       tjit compile-model <in> <model>\n");
+    printf("  <in> is a machine file, or a model made from one by compile-model\n");
+    printf("  -b  Call the function on each line of parameters, '-' for stdin\n");
+    printf("  -c  Compile as -e, keeping the code in this directory\n");
+    printf("  -d  Grow the tape only in the direction the head ran off\n");
+    printf("  -e  Compile all reachable states before running\n");
+    printf("  -f  Order rules and lay out -e code by the hits in this profile\n");
+    printf("  -F  Write rule hits to this profile for -f\n");
+    printf("  -g  Grow the tape on faults instead of checking bounds\n");
+    printf("  -G  Multiply the tape size by this factor when growing\n");
+    printf("  -i  Interpret states until entered this often (0: never)\n");
+    printf("  -I  Interpret every state, never compiling any\n");
+    printf("  -j  Compile on this many threads with -e\n");
+    printf("  -J  Write state and rule counts as JSON to this file, '-' for stdout\n");
+    printf("  -l  Give up on calls after this many state entries\n");
+    printf("  -n  Compile the machine as written, without optimizing it\n");
+    printf("  -p  Name generated code for perf in /tmp/perf-<pid>.map\n");
+    printf("  -P  As -p, and write a jitdump file for perf inject --jit\n");
+    printf("  -q  Time-slice -b calls, running each this many state entries at a time\n");
+    printf("  -s  Form superblocks from states entered this often (0: never)\n");
+    printf("  -S  Report state and rule counts and compile costs on stderr\n");
+    printf("  -t  Run -b on this many threads (0: one per CPU)\n");
+    printf("  -v  Increase trace level (compiles, tape dumps, every step)\n");
+    exit(1);
+}
+
 int main(int argc, char **argv)
 {
-    if (argc < 3)
-    {
-        printf("Usage: tjit <in> <func> [params]\n");
-        return 1;
+    JIT::Options options;
+    const char *batch = 0;
+    int batchThreads = 1;
+    uint64_t slice = 0;
+    bool report = false;
+    const char *jsonFile = 0;
+    const char *profileFile = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "b:c:def:F:gG:i:Ij:J:l:npPq:s:St:v")) != -1) {
+        switch (opt) {
+        case 'b':
+            batch = optarg;
+            break;
+        case 'c':
+            options.cacheDirectory = optarg;
+            options.eager = true;
+            break;
+        case 'd':
+            options.tapeRecenter = false;
+            break;
+        case 'e':
+            options.eager = true;
+            break;
+        case 'f':
+            options.profile = optarg;
+            break;
+        case 'F':
+            profileFile = optarg;
+            options.stats = true;
+            break;
+        case 'g':
+            options.tapeKind = Tape::GUARDED;
+            break;
+        case 'G':
+            options.tapeGrowthFactor = strtol(optarg, NULL, 0);
+            if (options.tapeGrowthFactor < 2)
+                usage();
+            break;
+        case 'i':
+            options.tierUpThreshold = strtoul(optarg, NULL, 0);
+            break;
+        case 'I':
+            options.interpretOnly = true;
+            break;
+        case 'j':
+            options.compileThreads = strtol(optarg, NULL, 0);
+            if (options.compileThreads < 1)
+                usage();
+            break;
+        case 'J':
+            jsonFile = optarg;
+            options.stats = true;
+            break;
+        case 'l':
+            options.stepLimit = strtoull(optarg, NULL, 0);
+            break;
+        case 'n':
+            options.optimize = false;
+            break;
+        case 'p':
+            options.perfMap = true;
+            break;
+        case 'P':
+            options.jitdump = true;
+            break;
+        case 'q':
+            slice = strtoull(optarg, NULL, 0);
+            options.fuel = slice != 0;
+            break;
+        case 's':
+            options.superblockThreshold = strtoul(optarg, NULL, 0);
+            break;
+        case 'S':
+            report = true;
+            options.stats = true;
+            break;
+        case 't':
+            batchThreads = strtol(optarg, NULL, 0);
+            if (batchThreads < 0)
+                usage();
+            if (batchThreads == 0)
+                batchThreads = sysconf(_SC_NPROCESSORS_ONLN);
+            break;
+        case 'v':
+            if (options.traceLevel < JIT::TRACE_STEPS)
+                options.traceLevel = (JIT::TraceLevel)(options.traceLevel + 1);
+            break;
+        default:
+            usage();
+        }
+    }
+    argc -= optind;
+    argv += optind;
+
+    bool compileModel = argc > 0 && !strcmp(argv[0], "compile-model");
+    if (compileModel) {
+        argc--;
+        argv++;
     }
+    if (argc < 2 || (compileModel && argc != 2))
+        usage();
 
-    // Parse file
-    string data(readfile(argv[1]));
-    map<string, Function *> *funcs(Parser(data).parse());
+    // Load a model, or parse the file
+    size_t length;
+    bool mapped;
+    const char *data = mapfile(argv[0], &length, &mapped);
+    map<string, Function *> *funcs;
+    if (Model::isModel(data, length)) {
+        funcs = Model::load(data, length);
+        if (!funcs)
+            errx(1, "Damaged model '%s'", argv[0]);
+    } else {
+        funcs = Parser(data, length).parse();
+    }
+    if (mapped)
+        munmap(const_cast<char *>(data), length);
+    else
+        free(const_cast<char *>(data));
     if (!funcs) {
         errx(1, "Parse error");
     }
 
+    if (compileModel) {
+        Model::save(argv[1], *funcs);
+        return 0;
+    }
+
     // Get requested function and check parameter count
-    map<string, Function *>::iterator funcIter = funcs->find(string(argv[2]));
+    map<string, Function *>::iterator funcIter = funcs->find(string(argv[1]));
     if (funcIter == funcs->end())
-        errx(1, "No such function '%s'", argv[2]);
+        errx(1, "No such function '%s'", argv[1]);
 
     Function *func = funcIter->second;
-    if (func->getArity() != argc - 3) 
-        errx(1, "Expected %d arguments, got %d", func->getArity(), argc - 3);
+    CompiledFunction function(func, options);
+    if (batch) {
+        if (argc != 2)
+            usage();
+        runBatch(function, batch, batchThreads, slice,
+                 options.traceLevel >= JIT::TRACE_TAPE);
+        writeStats(function, report, jsonFile, profileFile);
+        return 0;
+    }
+
+    if (func->getArity() != argc - 2) 
+        errx(1, "Expected %d arguments, got %d", func->getArity(), argc - 2);
 
     unsigned int params[func->getArity()];
     for (int i = 0; i < func->getArity(); i++)
-        params[i] = strtoul(argv[i + 3], NULL, 0); 
+        params[i] = strtoul(argv[i + 2], NULL, 0); 
 
-    int result = JIT(func, params).run();
-    printf("----------------------------------------------------------\n");
+    int result;
+    bool halted = function.call(params, &result);
+    writeStats(function, report, jsonFile, profileFile);
+    if (!halted)
+        errx(1, "No result after %llu steps",
+             (unsigned long long)options.stepLimit);
+    if (options.traceLevel >= JIT::TRACE_TAPE)
+        printf("----------------------------------------------------------\n");
     printf("Result: %d\n", result);
     return 0;
 }
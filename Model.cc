@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <assert.h>
+#include <cstdio>
+#include <cstring>
+#include <err.h>
+#include <vector>
+
+#include "Model.hh"
+
+using namespace std;
+
+static bool ValidState(int32_t state)
+{
+    return 0 <= state && state < INT32_MAX;
+}
+
+// Tapes the function's rules use, counted as its machine would
+int64_t Model::getTapeCount(const FunctionEntry &function,
+                            const RuleEntry *rules,
+                            const PatternEntry *patterns)
+{
+    int64_t count = 0;
+    for (uint32_t i = 0; i < function.ruleCount; i++) {
+        const RuleEntry &rule = rules[function.firstRule + i];
+        for (uint32_t j = 0; j < rule.conditionCount; j++) {
+            count = max(count,
+                        (int64_t)patterns[rule.firstCondition + j].tape + 1);
+        }
+        for (uint32_t j = 0; j < rule.actionCount; j++) {
+            count = max(count,
+                        (int64_t)patterns[rule.firstAction + j].tape + 1);
+        }
+    }
+    return count;
+}
+
+bool Model::isModel(const char *data, size_t length)
+{
+    return length >= sizeof(Header) &&
+           ((const Header *)data)->magic == MAGIC;
+}
+
+// Returns 0 if the model is damaged or from another version
+map<string, Function *> *Model::load(const char *data, size_t length)
+{
+    assert(isModel(data, length));
+    const Header *header = (const Header *)data;
+    if (header->version != VERSION)
+        return 0;
+
+    uint64_t size = sizeof(Header) +
+                    (uint64_t)header->functionCount * sizeof(FunctionEntry) +
+                    (uint64_t)header->ruleCount * sizeof(RuleEntry) +
+                    (uint64_t)header->patternCount * sizeof(PatternEntry) +
+                    header->stringSize;
+    if (size != length)
+        return 0;
+
+    const FunctionEntry *functions = (const FunctionEntry *)(header + 1);
+    const RuleEntry *rules =
+        (const RuleEntry *)(functions + header->functionCount);
+    const PatternEntry *patterns =
+        (const PatternEntry *)(rules + header->ruleCount);
+    const char *strings = (const char *)(patterns + header->patternCount);
+
+    // The machine counts states and tapes as the highest index plus one, so
+    // every index must be non-negative and below INT32_MAX
+    for (uint32_t i = 0; i < header->patternCount; i++) {
+        if (patterns[i].tape >= INT32_MAX)
+            return 0;
+    }
+    for (uint32_t i = 0; i < header->ruleCount; i++) {
+        const RuleEntry &rule = rules[i];
+        if (!ValidState(rule.fromState) || !ValidState(rule.toState) ||
+            (uint64_t)rule.firstCondition + rule.conditionCount >
+                header->patternCount ||
+            (uint64_t)rule.firstAction + rule.actionCount >
+                header->patternCount)
+            return 0;
+    }
+    for (uint32_t i = 0; i < header->functionCount; i++) {
+        const FunctionEntry &function = functions[i];
+        if (function.arity < 0 ||
+            !ValidState(function.initState) ||
+            !ValidState(function.haltState) ||
+            (uint64_t)function.firstRule + function.ruleCount >
+                header->ruleCount ||
+            (uint64_t)function.name + function.nameLength > header->stringSize)
+            return 0;
+
+        // The parser takes no more params than there are tapes, so neither
+        // do we: a damaged arity would otherwise size the params and tape
+        if (function.arity > getTapeCount(function, rules, patterns))
+            return 0;
+    }
+
+    map<string, Function *> *result = new map<string, Function *>();
+    vector<Pattern> machinePatterns;
+    vector<Machine::RuleSpec> machineRules;
+    for (uint32_t i = 0; i < header->functionCount; i++) {
+        const FunctionEntry &function = functions[i];
+        machineRules.resize(function.ruleCount);
+        size_t patternCount = 0;
+        for (uint32_t j = 0; j < function.ruleCount; j++) {
+            const RuleEntry &entry = rules[function.firstRule + j];
+            patternCount += entry.conditionCount + entry.actionCount;
+        }
+
+        // The machine takes these over, so each pattern is copied once
+        machinePatterns.reserve(patternCount);
+        for (uint32_t j = 0; j < function.ruleCount; j++) {
+            const RuleEntry &entry = rules[function.firstRule + j];
+            Machine::RuleSpec &rule = machineRules[j];
+            rule.fromState = entry.fromState;
+            rule.toState = entry.toState;
+            rule.delta = entry.delta;
+            rule.firstCondition = machinePatterns.size();
+            rule.conditionSize = entry.conditionCount;
+            const PatternEntry *condition = &patterns[entry.firstCondition];
+            for (uint32_t k = 0; k < entry.conditionCount; k++) {
+                machinePatterns.push_back(Pattern(condition[k].symbol,
+                                                  condition[k].tape));
+            }
+            rule.firstAction = machinePatterns.size();
+            rule.actionSize = entry.actionCount;
+            const PatternEntry *action = &patterns[entry.firstAction];
+            for (uint32_t k = 0; k < entry.actionCount; k++) {
+                machinePatterns.push_back(Pattern(action[k].symbol,
+                                                  action[k].tape));
+            }
+        }
+        Machine *machine = new Machine(function.initState, function.haltState,
+                                       machinePatterns, machineRules);
+        string name(strings + function.name, function.nameLength);
+        (*result)[name] = new Function(name, function.arity, machine);
+    }
+    return result;
+}
+
+void Model::save(const string &path, map<string, Function *> &functions)
+{
+    vector<FunctionEntry> functionEntries;
+    vector<RuleEntry> ruleEntries;
+    vector<PatternEntry> patternEntries;
+    string strings;
+
+    for (map<string, Function *>::iterator i = functions.begin();
+         i != functions.end();
+         i++)
+    {
+        Function *function = i->second;
+        Machine *machine = function->getMachine();
+        Rule *rules = machine->getRules();
+
+        FunctionEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.name = strings.size();
+        entry.nameLength = function->getName()->size();
+        entry.arity = function->getArity();
+        entry.initState = machine->getInitState();
+        entry.haltState = machine->getHaltState();
+        entry.firstRule = ruleEntries.size();
+        entry.ruleCount = machine->getRuleCount();
+        functionEntries.push_back(entry);
+        strings += *function->getName();
+
+        for (unsigned int r = 0; r < machine->getRuleCount(); r++) {
+            RuleEntry rule;
+            rule.fromState = rules[r].getFromState();
+            rule.toState = rules[r].getToState();
+            rule.delta = rules[r].getDelta();
+            rule.firstCondition = patternEntries.size();
+            rule.conditionCount = rules[r].getConditionSize();
+            rule.firstAction = rule.firstCondition + rule.conditionCount;
+            rule.actionCount = rules[r].getActionSize();
+
+            Pattern *lists[] = {
+                rules[r].getCondition(), rules[r].getAction()
+            };
+            unsigned int sizes[] = { rule.conditionCount, rule.actionCount };
+            for (int l = 0; l < 2; l++) {
+                for (unsigned int p = 0; p < sizes[l]; p++) {
+                    PatternEntry pattern;
+                    memset(&pattern, 0, sizeof(pattern));
+                    pattern.tape = lists[l][p].getTape();
+                    pattern.symbol = lists[l][p].getSymbol();
+                    patternEntries.push_back(pattern);
+                }
+            }
+            ruleEntries.push_back(rule);
+        }
+    }
+
+    Header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.functionCount = functionEntries.size();
+    header.ruleCount = ruleEntries.size();
+    header.patternCount = patternEntries.size();
+    header.stringSize = strings.size();
+
+    FILE *out = fopen(path.c_str(), "wb");
+    if (!out)
+        err(1, "Unable to write model '%s'", path.c_str());
+    fwrite(&header, sizeof(header), 1, out);
+    if (!functionEntries.empty())
+        fwrite(&functionEntries[0], sizeof(FunctionEntry),
+               functionEntries.size(), out);
+    if (!ruleEntries.empty())
+        fwrite(&ruleEntries[0], sizeof(RuleEntry), ruleEntries.size(), out);
+    if (!patternEntries.empty())
+        fwrite(&patternEntries[0], sizeof(PatternEntry),
+               patternEntries.size(), out);
+    fwrite(strings.data(), 1, strings.size(), out);
+    if (ferror(out) | fclose(out))
+        err(1, "Unable to write model '%s'", path.c_str());
+}
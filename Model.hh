@@ -0,0 +1,88 @@
+#ifndef MODEL_HH__
+#define MODEL_HH__
+
+#include <cstddef>
+#include <map>
+#include <stdint.h>
+#include <string>
+
+#include "Function.hh"
+
+/*
+ * Parsed functions saved in binary, so loading them needs no parsing. The
+ * file is a header and then flat tables, laid out to be used where it is
+ * mapped: the functions, each naming a run of the rules; the rules, each
+ * naming runs of the patterns; the patterns; and the function names. Numbers
+ * are stored as the machine has them, so a model only loads where it was
+ * compiled.
+ */
+class Model
+{
+public:
+    static bool isModel(const char *data, size_t length);
+
+    static std::map<std::string, Function *> *load(const char *data,
+                                                   size_t length);
+    static void save(const std::string &path,
+                     std::map<std::string, Function *> &functions);
+
+private:
+    class Header;
+    class FunctionEntry;
+    class RuleEntry;
+    class PatternEntry;
+
+    static const uint64_t MAGIC = 0x4c444f4d54494a54ull;
+    static const uint32_t VERSION = 1;
+
+    static int64_t getTapeCount(const FunctionEntry &function,
+                                const RuleEntry *rules,
+                                const PatternEntry *patterns);
+};
+
+class Model::Header
+{
+public:
+    uint64_t magic;
+    uint32_t version;
+    uint32_t functionCount;
+    uint32_t ruleCount;
+    uint32_t patternCount;
+    uint32_t stringSize;
+    uint32_t reserved;
+};
+
+class Model::FunctionEntry
+{
+public:
+    uint32_t name;
+    uint32_t nameLength;
+    int32_t arity;
+    int32_t initState;
+    int32_t haltState;
+    uint32_t firstRule;
+    uint32_t ruleCount;
+    uint32_t reserved;
+};
+
+class Model::RuleEntry
+{
+public:
+    int32_t fromState;
+    int32_t toState;
+    int32_t delta;
+    uint32_t firstCondition;
+    uint32_t conditionCount;
+    uint32_t firstAction;
+    uint32_t actionCount;
+};
+
+class Model::PatternEntry
+{
+public:
+    uint32_t tape;
+    uint8_t symbol;
+    uint8_t reserved[3];
+};
+
+#endif
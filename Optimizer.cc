@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <map>
+
+#include "Optimizer.hh"
+
+using namespace std;
+
+// The order the JIT tests rules in; see RuleCompare
+static bool TestOrder(Rule *l, Rule *r)
+{
+    return l->getConditionSize() > r->getConditionSize();
+}
+
+Optimizer::Optimizer(Machine *machine) :
+    mMachine(machine),
+    mStates(machine->getStateCount()),
+    mReachable(machine->getStateCount(), false),
+    mMerged(machine->getStateCount())
+{
+    for (int s = 0; s < machine->getStateCount(); s++)
+        mMerged[s] = s;
+}
+
+Machine *Optimizer::optimize()
+{
+    dropDeadRules();
+    dropUnreachableStates();
+    mergeStates();
+    return build();
+}
+
+void Optimizer::dropDeadRules()
+{
+    for (int s = 0; s < mMachine->getStateCount(); s++) {
+        vector<Rule *> rules;
+        Rule *stateRules = mMachine->getStateRules(s);
+        for (unsigned int i = 0; i < mMachine->getStateRuleCount(s); i++)
+            rules.push_back(&stateRules[i]);
+        stable_sort(rules.begin(), rules.end(), TestOrder);
+
+        // Conditions are kept as sorted (tape, symbol) pairs
+        vector<vector<pair<int, int> > > conditions;
+        for (vector<Rule *>::iterator i = rules.begin(); i != rules.end(); i++) {
+            Pattern *patterns = (*i)->getCondition();
+            vector<pair<int, int> > condition;
+            for (unsigned int j = 0; j < (*i)->getConditionSize(); j++) {
+                condition.push_back(make_pair(patterns[j].getTape(),
+                                              (int)patterns[j].getSymbol()));
+            }
+            sort(condition.begin(), condition.end());
+            condition.erase(unique(condition.begin(), condition.end()),
+                            condition.end());
+
+            bool contradicts = false;
+            for (unsigned int j = 1; j < condition.size(); j++) {
+                if (condition[j].first == condition[j - 1].first)
+                    contradicts = true;
+            }
+            if (contradicts)
+                continue;
+
+            // Shadowed by an earlier rule testing a subset of these cells
+            bool shadowed = false;
+            for (vector<vector<pair<int, int> > >::iterator j =
+                     conditions.begin();
+                 j != conditions.end() && !shadowed;
+                 j++)
+            {
+                shadowed = j->size() <= condition.size() &&
+                           includes(condition.begin(), condition.end(),
+                                    j->begin(), j->end());
+            }
+            if (shadowed)
+                continue;
+            conditions.push_back(condition);
+
+            // Later writes to a tape win
+            map<int, int> writes;
+            patterns = (*i)->getAction();
+            for (unsigned int j = 0; j < (*i)->getActionSize(); j++)
+                writes[patterns[j].getTape()] = patterns[j].getSymbol();
+
+            Transition transition;
+            transition.rule = *i;
+            for (map<int, int>::iterator j = writes.begin();
+                 j != writes.end();
+                 j++)
+            {
+                if (!binary_search(condition.begin(), condition.end(),
+                                   make_pair(j->first, j->second)))
+                    transition.action.push_back(Pattern(j->second, j->first));
+            }
+            mStates[s].push_back(transition);
+        }
+    }
+}
+
+void Optimizer::dropUnreachableStates()
+{
+    int init = mMachine->getInitState();
+    int halt = mMachine->getHaltState();
+
+    vector<int> worklist(1, init);
+    mReachable[init] = true;
+    while (!worklist.empty()) {
+        int s = worklist.back();
+        worklist.pop_back();
+        if (s == halt)
+            continue;
+        for (vector<Transition>::iterator i = mStates[s].begin();
+             i != mStates[s].end();
+             i++)
+        {
+            int to = i->rule->getToState();
+            if (!mReachable[to]) {
+                mReachable[to] = true;
+                worklist.push_back(to);
+            }
+        }
+    }
+
+    for (int s = 0; s < mMachine->getStateCount(); s++) {
+        if (!mReachable[s] || s == halt)
+            mStates[s].clear();
+    }
+}
+
+// Classes are numbered afresh each round from the signatures of their
+// states, which include the state's class so far, so they only ever split
+// and settle within as many rounds as there are states
+void Optimizer::mergeStates()
+{
+    int stateCount = mMachine->getStateCount();
+    vector<int> classes(stateCount, -1);
+    int classCount = 0;
+
+    map<vector<int>, int> ids;
+    for (int s = 0; s < stateCount; s++) {
+        if (!mReachable[s])
+            continue;
+
+        vector<int> signature;
+        signature.push_back(s == mMachine->getHaltState());
+        for (vector<Transition>::iterator i = mStates[s].begin();
+             i != mStates[s].end();
+             i++)
+        {
+            Pattern *condition = i->rule->getCondition();
+            signature.push_back(i->rule->getConditionSize());
+            for (unsigned int j = 0; j < i->rule->getConditionSize(); j++) {
+                signature.push_back(condition[j].getTape());
+                signature.push_back(condition[j].getSymbol());
+            }
+            signature.push_back(i->action.size());
+            for (vector<Pattern>::iterator j = i->action.begin();
+                 j != i->action.end();
+                 j++)
+            {
+                signature.push_back(j->getTape());
+                signature.push_back(j->getSymbol());
+            }
+            signature.push_back(i->rule->getDelta());
+        }
+
+        map<vector<int>, int>::iterator id = ids.find(signature);
+        if (id == ids.end())
+            id = ids.insert(make_pair(signature, classCount++)).first;
+        classes[s] = id->second;
+    }
+
+    for (;;) {
+        vector<int> next(stateCount, -1);
+        int nextCount = 0;
+        ids.clear();
+        for (int s = 0; s < stateCount; s++) {
+            if (!mReachable[s])
+                continue;
+
+            vector<int> signature(1, classes[s]);
+            for (vector<Transition>::iterator i = mStates[s].begin();
+                 i != mStates[s].end();
+                 i++)
+            {
+                signature.push_back(classes[i->rule->getToState()]);
+            }
+
+            map<vector<int>, int>::iterator id = ids.find(signature);
+            if (id == ids.end())
+                id = ids.insert(make_pair(signature, nextCount++)).first;
+            next[s] = id->second;
+        }
+
+        classes.swap(next);
+        if (nextCount == classCount) {
+            // Stable, so merge each class into its lowest state
+            vector<int> lowest(classCount, -1);
+            for (int s = 0; s < stateCount; s++) {
+                if (!mReachable[s])
+                    continue;
+                if (lowest[classes[s]] < 0)
+                    lowest[classes[s]] = s;
+                mMerged[s] = lowest[classes[s]];
+            }
+            return;
+        }
+        classCount = nextCount;
+    }
+}
+
+Machine *Optimizer::build()
+{
+    vector<Pattern> patterns;
+    vector<Machine::RuleSpec> rules;
+    for (int s = 0; s < mMachine->getStateCount(); s++) {
+        if (mMerged[s] != s)
+            continue;
+        for (vector<Transition>::iterator i = mStates[s].begin();
+             i != mStates[s].end();
+             i++)
+        {
+            Machine::RuleSpec rule;
+            rule.fromState = s;
+            rule.toState = mMerged[i->rule->getToState()];
+            rule.delta = i->rule->getDelta();
+            rule.firstCondition = patterns.size();
+            rule.conditionSize = i->rule->getConditionSize();
+            patterns.insert(patterns.end(), i->rule->getCondition(),
+                            i->rule->getCondition() + rule.conditionSize);
+            rule.firstAction = patterns.size();
+            rule.actionSize = i->action.size();
+            patterns.insert(patterns.end(), i->action.begin(),
+                            i->action.end());
+            rules.push_back(rule);
+        }
+    }
+
+    return new Machine(mMerged[mMachine->getInitState()],
+                       mMachine->getHaltState(), patterns, rules);
+}
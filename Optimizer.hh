@@ -0,0 +1,56 @@
+#ifndef OPTIMIZER_HH__
+#define OPTIMIZER_HH__
+
+#include <vector>
+
+#include "Machine.hh"
+
+/*
+ * Rewrites a machine into a smaller one that computes the same function,
+ * for the JIT to compile instead. Each state's rules are taken in the order
+ * they are tested, most specific first, and
+ *
+ *  - rules that can never fire are dropped: those whose condition
+ *    contradicts itself, and those only matching where an earlier rule
+ *    already matches;
+ *  - writes of the symbol a rule has just tested are dropped;
+ *  - states that can't be reached from the initial state lose their rules,
+ *    as does the halting state;
+ *  - states that behave alike are merged, as in DFA minimization: states
+ *    start out together when their rules test and write the same cells and
+ *    move alike, and are split apart until the rules of states still
+ *    together go to states that are together too.
+ *
+ * States keep their numbers; a merged state's rules are those of the
+ * lowest-numbered state it was merged with.
+ */
+class Optimizer
+{
+public:
+    Optimizer(Machine *machine);
+
+    Machine *optimize();
+
+private:
+    class Transition;
+
+    Machine *mMachine;
+    std::vector<std::vector<Transition> > mStates;
+    std::vector<bool> mReachable;
+    std::vector<int> mMerged;
+
+    void dropDeadRules();
+    void dropUnreachableStates();
+    void mergeStates();
+    Machine *build();
+};
+
+// A rule that may fire, with the writes that change the tape
+class Optimizer::Transition
+{
+public:
+    Rule *rule;
+    std::vector<Pattern> action;
+};
+
+#endif
@@ -1,18 +1,35 @@
 #include "Parser.hh"
 
 #include <assert.h>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <err.h>
+#include <new>
 
 using namespace std;
 
-Parser::Parser(const string &input) : mInput(input)
+Parser::Parser(const char *input, size_t length) :
+    mInput(input),
+    mLength(length)
+{
+}
+
+Parser::Parser(const string &input) :
+    mInput(input.data()),
+    mLength(input.length())
 {
 }
 
 map<string, Function *> *Parser::parse()
 {
-    unsigned int idx = 0;
+    size_t idx = 0;
+    while (idx < mLength && isspace((unsigned char)mInput[idx]))
+        idx++;
+    if (idx == mLength || mInput[idx] != '(')
+        return 0;
+
+    mStack.clear();
     SExpr *sexpr = parseSexpr(idx);
     if (!sexpr)
         return 0;
@@ -35,14 +52,17 @@ Function *Parser::parseFunction(SExpr *sexpr)
     if (!sexpr->isString(0) || !sexpr->isString(1) || !sexpr->isSexpr(2))
         return 0;
     
-    string *name = sexpr->getString(0);
-    string *arityStr = sexpr->getString(1);
-    int arity = strtol(arityStr->c_str(), NULL, 0);
+    // Each param is on a tape of its own, which the machine must use
+    int arity = sexpr->getLong(1);
     Machine *machine = parseMachine(sexpr->getSexpr(2));
     if (!machine)
         return 0;
+    if (arity < 0 || arity > machine->getTapeCount()) {
+        delete machine;
+        return 0;
+    }
 
-    return new Function(*name, arity, machine);
+    return new Function(sexpr->getString(0), arity, machine);
 }
 
 Machine *Parser::parseMachine(SExpr *sexpr)
@@ -54,97 +74,91 @@ Machine *Parser::parseMachine(SExpr *sexpr)
         return 0;
     }
 
-    string *startStr = sexpr->getString(0);
-    string *haltStr = sexpr->getString(1);
-    vector<Rule *> *rules = parseRules(sexpr->getSexpr(2));
-
-    int start = strtol(startStr->c_str(), NULL, 0);
-    int halt = strtol(haltStr->c_str(), NULL, 0);
-    assert(rules);
-    if (!rules)
+    int start = sexpr->getLong(0);
+    int halt = sexpr->getLong(1);
+    vector<Pattern> patterns;
+    vector<Machine::RuleSpec> rules;
+    bool ok = parseRules(sexpr->getSexpr(2), patterns, rules);
+    assert(ok);
+    if (!ok)
         return 0;
 
-    return new Machine(start, halt, *rules);
+    return new Machine(start, halt, patterns, rules);
 }
 
-vector<Rule *> *Parser::parseRules(SExpr *sexpr)
+bool Parser::parseRules(SExpr *sexpr, vector<Pattern> &patterns,
+                        vector<Machine::RuleSpec> &rules)
 {
-    vector<Rule *> *result = new vector<Rule *>();
+    rules.resize(sexpr->length());
     for (int i = 0; i < sexpr->length(); i++) {
-        if (!sexpr->isSexpr(i))
-            return 0;
-        Rule *rule = parseRule(sexpr->getSexpr(i));
-        if (!rule)
-            return 0;
-        result->push_back(rule);
+        if (!sexpr->isSexpr(i) ||
+            !parseRule(sexpr->getSexpr(i), patterns, rules[i]))
+            return false;
     }
-    return result;
+    return true;
 }
 
-Rule *Parser::parseRule(SExpr *sexpr)
+bool Parser::parseRule(SExpr *sexpr, vector<Pattern> &patterns,
+                       Machine::RuleSpec &rule)
 {
     if (!sexpr->isString(0) ||
         !sexpr->isString(1) ||
         !sexpr->isSexpr(2) ||
         !sexpr->isSexpr(3) ||
         !sexpr->isString(4)) {
-        return 0;
+        return false;
     }
 
-    string *startStr = sexpr->getString(0);
-    string *nextStr = sexpr->getString(1);
-    vector<Pattern *> *condPatterns = parsePatterns(sexpr->getSexpr(2));
-    vector<Pattern *> *actPatterns = parsePatterns(sexpr->getSexpr(3));
-    string *deltaStr = sexpr->getString(4);
-
-    int start = strtol(startStr->c_str(), NULL, 0);
-    int next = strtol(nextStr->c_str(), NULL, 0);
-    if (!condPatterns || !actPatterns)
-        return 0;
-    int delta = strtol(deltaStr->c_str(), NULL, 0);
-
-    return new Rule(start, next, *condPatterns, *actPatterns, delta);
+    rule.fromState = sexpr->getLong(0);
+    rule.toState = sexpr->getLong(1);
+    rule.firstCondition = patterns.size();
+    if (!parsePatterns(sexpr->getSexpr(2), patterns))
+        return false;
+    rule.conditionSize = patterns.size() - rule.firstCondition;
+    rule.firstAction = patterns.size();
+    if (!parsePatterns(sexpr->getSexpr(3), patterns))
+        return false;
+    rule.actionSize = patterns.size() - rule.firstAction;
+    rule.delta = sexpr->getLong(4);
+    return true;
 }
 
-std::vector<Pattern *> *Parser::parsePatterns(SExpr *sexpr)
+bool Parser::parsePatterns(SExpr *sexpr, vector<Pattern> &patterns)
 {
-    vector<Pattern *> *result = new vector<Pattern *>();
     for (int i = 0; i < sexpr->length(); i++) {
-        if (!sexpr->isSexpr(i))
-            return 0;
-        Pattern *rule = parsePattern(sexpr->getSexpr(i));
-        if (!rule)
-            return 0;
-        result->push_back(rule);
+        if (!sexpr->isSexpr(i) || !parsePattern(sexpr->getSexpr(i), patterns))
+            return false;
     }
-    return result;
+    return true;
 }
 
-Pattern *Parser::parsePattern(SExpr *sexpr)
+bool Parser::parsePattern(SExpr *sexpr, vector<Pattern> &patterns)
 {
     if (sexpr->length() < 2 || !sexpr->isString(0) || !sexpr->isString(1))
-        return 0;
-
-    string *symbolStr = sexpr->getString(0);
-    string *tapeStr = sexpr->getString(1);
+        return false;
 
-    unsigned char symbol = (unsigned char)strtoul(symbolStr->c_str(), NULL, 0);
-    unsigned int tape = strtoul(tapeStr->c_str(), NULL, 0);
-
-    return new Pattern(symbol, tape);
+    unsigned char symbol = (unsigned char)sexpr->getUnsigned(0);
+    unsigned int tape = sexpr->getUnsigned(1);
+    patterns.push_back(Pattern(symbol, tape));
+    return true;
 }
 
-Parser::SExpr *Parser::parseSexpr(unsigned int &idx)
+// Items of the lists being read wait on mStack until their list is closed,
+// then move to the arena
+Parser::SExpr *Parser::parseSexpr(size_t &idx)
 {
-    assert(idx < mInput.length());
+    assert(idx < mLength);
     assert(mInput[idx] == '(');
 
-    SExpr *result = new SExpr();
+    size_t first = mStack.size();
 
     idx++;
-    while (idx < mInput.length()) {
+    while (idx < mLength) {
         switch (mInput[idx]) {
         case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
             idx++;
             break;
 
@@ -152,23 +166,30 @@ Parser::SExpr *Parser::parseSexpr(unsigned int &idx)
             SExpr *sub = parseSexpr(idx);
             if (!sub)
                 return 0;
-            result->push(sub);
+            mStack.push_back(Item(sub));
             break;
         }
 
-        case ')':
+        case ')': {
             idx++;
-            return result;
+            int length = mStack.size() - first;
+            Item *items = (Item *)mArena.allocate(length * sizeof(Item));
+            if (length)
+                memcpy(items, &mStack[first], length * sizeof(Item));
+            mStack.resize(first, Item(0));
+            return new (mArena.allocate(sizeof(SExpr))) SExpr(items, length);
+        }
 
         default: {
-            unsigned int sidx = idx + 1;
-            while (sidx < mInput.length() && mInput[sidx] != ' ' && mInput[sidx] != ')')
+            size_t sidx = idx + 1;
+            while (sidx < mLength && mInput[sidx] != ')' &&
+                   !isspace((unsigned char)mInput[sidx]))
                 sidx++;
 
-            if (sidx == mInput.length())
+            if (sidx == mLength)
                 return 0;
 
-            result->push(mInput.substr(idx, sidx - idx));
+            mStack.push_back(Item(mInput + idx, sidx - idx));
             idx = sidx;
             break;
         }
@@ -179,70 +200,72 @@ Parser::SExpr *Parser::parseSexpr(unsigned int &idx)
     return 0;
 }
 
-void Parser::SExpr::push(SExpr *sexpr)
+Parser::Item::Item(SExpr *sexpr) :
+    sexpr(sexpr),
+    text(0),
+    length(0)
 {
-    mValues.push_back(sexpr);
 }
 
-void Parser::SExpr::push(const std::string &str)
+Parser::Item::Item(const char *text, unsigned int length) :
+    sexpr(0),
+    text(text),
+    length(length)
+{
+}
+
+Parser::SExpr::SExpr(Item *items, int length) :
+    mItems(items),
+    mLength(length)
 {
-    mValues.push_back(new string(str));
 }
 
 int Parser::SExpr::length()
 {
-    return mValues.size();
+    return mLength;
 }
 
 bool Parser::SExpr::isSexpr(unsigned int index)
 {
-    return mValues[index].isSexpr();
+    return mItems[index].sexpr != 0;
 }
 
 bool Parser::SExpr::isString(unsigned int index)
 {
-    return mValues[index].isString();
+    return mItems[index].sexpr == 0;
 }
 
 Parser::SExpr *Parser::SExpr::getSexpr(unsigned int index)
 {
-    return mValues[index].getSexpr();
-}
-
-std::string *Parser::SExpr::getString(unsigned int index)
-{
-    return mValues[index].getString();
-}
-
-Parser::SExpr::SExprOrString::SExprOrString(SExpr *sexpr) : mIsSexpr(true)
-{
-    mValue.sexpr = sexpr;
+    assert(isSexpr(index));
+    return mItems[index].sexpr;
 }
 
-Parser::SExpr::SExprOrString::SExprOrString(string *str) : mIsSexpr(false)
+string Parser::SExpr::getString(unsigned int index)
 {
-    mValue.str = str;
+    assert(isString(index));
+    return string(mItems[index].text, mItems[index].length);
 }
 
-bool Parser::SExpr::SExprOrString::isSexpr() const
+long Parser::SExpr::getLong(unsigned int index)
 {
-    return mIsSexpr;
+    char buffer[32];
+    return strtol(getNumber(index, buffer, sizeof(buffer)), NULL, 0);
 }
 
-bool Parser::SExpr::SExprOrString::isString() const
+unsigned long Parser::SExpr::getUnsigned(unsigned int index)
 {
-    return !mIsSexpr;
+    char buffer[32];
+    return strtoul(getNumber(index, buffer, sizeof(buffer)), NULL, 0);
 }
 
-Parser::SExpr *Parser::SExpr::SExprOrString::getSexpr() const
+// Atoms aren't terminated in the input, so numbers are copied out first
+const char *Parser::SExpr::getNumber(unsigned int index, char *buffer,
+                                     size_t size)
 {
-    assert(mIsSexpr);
-    return mValue.sexpr;
+    assert(isString(index));
+    size_t length = min((size_t)mItems[index].length, size - 1);
+    memcpy(buffer, mItems[index].text, length);
+    buffer[length] = '\0';
+    return buffer;
 }
-
-string *Parser::SExpr::SExprOrString::getString() const
-{
-    assert(!mIsSexpr);
-    return mValue.str;
-}
-
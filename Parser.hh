@@ -1,45 +1,69 @@
 #ifndef PARSER_HH__
 #define PARSER_HH__
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "Arena.hh"
 #include "Function.hh"
 
+/*
+ * Reads functions from s-expressions, in place: atoms are left in the input
+ * rather than copied out, and the lists are allocated from an arena that
+ * goes away with the parser. The input must outlive the parser.
+ */
 class Parser
 {
 public:
+    Parser(const char *input, size_t length);
     Parser(const std::string &input);
 
     std::map<std::string, Function *> *parse();
 
 private:
     class SExpr;
+    class Item;
 
-    std::string mInput;
+    const char *mInput;
+    size_t mLength;
+    Arena mArena;
+    std::vector<Item> mStack;
 
     Function *parseFunction(SExpr *sexpr);
 
     Machine *parseMachine(SExpr *sexpr);
 
-    std::vector<Rule *> *parseRules(SExpr *sexpr);
+    bool parseRules(SExpr *sexpr, std::vector<Pattern> &patterns,
+                    std::vector<Machine::RuleSpec> &rules);
 
-    Rule *parseRule(SExpr *sexpr);
+    bool parseRule(SExpr *sexpr, std::vector<Pattern> &patterns,
+                   Machine::RuleSpec &rule);
 
-    std::vector<Pattern *> *parsePatterns(SExpr *sexpr);
+    bool parsePatterns(SExpr *sexpr, std::vector<Pattern> &patterns);
 
-    Pattern *parsePattern(SExpr *sexpr);
+    bool parsePattern(SExpr *sexpr, std::vector<Pattern> &patterns);
 
-    SExpr *parseSexpr(unsigned int& idx);
+    SExpr *parseSexpr(size_t &idx);
 };
 
-class Parser::SExpr
+class Parser::Item
 {
 public:
-    void push(SExpr *sexpr);
+    Item(SExpr *sexpr);
+    Item(const char *text, unsigned int length);
 
-    void push(const std::string &str);
+    // Atoms have no sexpr
+    SExpr *sexpr;
+    const char *text;
+    unsigned int length;
+};
+
+class Parser::SExpr
+{
+public:
+    SExpr(Item *items, int length);
 
     int length();
 
@@ -49,37 +73,18 @@ public:
 
     SExpr *getSexpr(unsigned int index);
 
-    std::string *getString(unsigned int index);
+    std::string getString(unsigned int index);
 
-private:
-    class SExprOrString;
+    // Numbers are read as strtol() and strtoul() would, in any base
+    long getLong(unsigned int index);
 
-    std::vector<SExprOrString> mValues;
-
-};
-
-class Parser::SExpr::SExprOrString
-{
-public:
-    SExprOrString(SExpr *sexpr);
-    
-    SExprOrString(std::string *string);
-    
-    bool isSexpr() const;
-    
-    bool isString() const;
-    
-    SExpr *getSexpr() const;
-    
-    std::string *getString() const;
+    unsigned long getUnsigned(unsigned int index);
 
 private:
-    bool mIsSexpr;
-    union
-    {
-        SExpr *sexpr;
-        std::string *str;
-    } mValue;
+    Item *mItems;
+    int mLength;
+
+    const char *getNumber(unsigned int index, char *buffer, size_t size);
 };
 
 #endif
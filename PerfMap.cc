@@ -0,0 +1,101 @@
+#include <cstdlib>
+#include <cstring>
+#include <err.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "PerfMap.hh"
+
+using namespace std;
+
+pthread_mutex_t PerfMap::sLock = PTHREAD_MUTEX_INITIALIZER;
+PerfMap *PerfMap::sInstance;
+
+PerfMap::PerfMap() :
+    mDump(0),
+    mCodeIndex(0)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/perf-%d.map", (int)getpid());
+    mMap = fopen(path, "w");
+    if (!mMap)
+        err(1, "Unable to create '%s'", path);
+}
+
+// Returns the process's map, creating it or adding a jitdump file to it
+// as needed
+PerfMap *PerfMap::open(bool jitdump)
+{
+    pthread_mutex_lock(&sLock);
+    if (!sInstance)
+        sInstance = new PerfMap();
+    if (jitdump && !sInstance->mDump)
+        sInstance->openDump();
+    pthread_mutex_unlock(&sLock);
+    return sInstance;
+}
+
+void PerfMap::openDump()
+{
+    const char *directory = getenv("JITDUMPDIR");
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/jit-%d.dump",
+             directory ? directory : "/tmp", (int)getpid());
+    mDump = fopen(path, "w+");
+    if (!mDump)
+        err(1, "Unable to create '%s'", path);
+
+    // perf record finds the file by seeing it mapped executable
+    if (mmap(0, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE,
+             fileno(mDump), 0) == MAP_FAILED)
+    {
+        err(1, "Unable to map '%s'", path);
+    }
+
+    DumpHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = DUMP_MAGIC;
+    header.version = DUMP_VERSION;
+    header.size = sizeof(header);
+    header.machine = EM_X86_64;
+    header.pid = getpid();
+    header.timestamp = getTimestamp();
+    fwrite(&header, sizeof(header), 1, mDump);
+    fflush(mDump);
+}
+
+void PerfMap::add(const void *code, size_t size, const string &name)
+{
+    pthread_mutex_lock(&sLock);
+    fprintf(mMap, "%lx %lx %s\n", (unsigned long)code, (unsigned long)size,
+            name.c_str());
+    fflush(mMap);
+
+    if (mDump) {
+        CodeLoad record;
+        record.id = JIT_CODE_LOAD;
+        record.size = sizeof(record) + name.size() + 1 + size;
+        record.timestamp = getTimestamp();
+        record.pid = getpid();
+        record.tid = syscall(SYS_gettid);
+        record.vma = (uint64_t)code;
+        record.codeAddress = (uint64_t)code;
+        record.codeSize = size;
+        record.codeIndex = mCodeIndex++;
+        fwrite(&record, sizeof(record), 1, mDump);
+        fwrite(name.c_str(), name.size() + 1, 1, mDump);
+        fwrite(code, size, 1, mDump);
+        fflush(mDump);
+    }
+    pthread_mutex_unlock(&sLock);
+}
+
+// perf record -k mono stamps its samples with the same clock
+uint64_t PerfMap::getTimestamp()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
@@ -0,0 +1,76 @@
+#ifndef PERFMAP_HH__
+#define PERFMAP_HH__
+
+#include <cstddef>
+#include <cstdio>
+#include <pthread.h>
+#include <stdint.h>
+#include <string>
+
+/*
+ * Tells Linux perf what generated code is where, so profiles name states
+ * rather than showing anonymous executable memory. Every piece of code
+ * gets a line in /tmp/perf-<pid>.map, which perf report reads as it is.
+ * Optionally it also goes into a jitdump file, jit-<pid>.dump in $JITDUMPDIR
+ * (or /tmp), which holds a copy of the code too; record with "perf record
+ * -k mono" and run "perf inject --jit" on the result to use it. There is
+ * one of these per process, shared by every JIT in it.
+ */
+class PerfMap
+{
+public:
+    static PerfMap *open(bool jitdump);
+
+    void add(const void *code, size_t size, const std::string &name);
+
+private:
+    class DumpHeader;
+    class CodeLoad;
+
+    static const uint32_t DUMP_MAGIC = 0x4A695444;
+    static const uint32_t DUMP_VERSION = 1;
+    static const uint32_t EM_X86_64 = 62;
+    static const uint32_t JIT_CODE_LOAD = 0;
+
+    static pthread_mutex_t sLock;
+    static PerfMap *sInstance;
+
+    FILE *mMap;
+    FILE *mDump;
+    uint64_t mCodeIndex;
+
+    PerfMap();
+    void openDump();
+    static uint64_t getTimestamp();
+};
+
+// The jitdump file header
+class PerfMap::DumpHeader
+{
+public:
+    uint32_t magic;
+    uint32_t version;
+    uint32_t size;
+    uint32_t machine;
+    uint32_t pad;
+    uint32_t pid;
+    uint64_t timestamp;
+    uint64_t flags;
+};
+
+// A jitdump record for newly loaded code, followed by its name and bytes
+class PerfMap::CodeLoad
+{
+public:
+    uint32_t id;
+    uint32_t size;
+    uint64_t timestamp;
+    uint32_t pid;
+    uint32_t tid;
+    uint64_t vma;
+    uint64_t codeAddress;
+    uint64_t codeSize;
+    uint64_t codeIndex;
+};
+
+#endif
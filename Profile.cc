@@ -0,0 +1,59 @@
+#include <cstdio>
+#include <err.h>
+
+#include "Profile.hh"
+
+using namespace std;
+
+Profile::Profile(const string &path) :
+    mPath(path)
+{
+}
+
+// Reads the counts, warning and returning false if there are none for
+// this function
+bool Profile::load(const string &function, int ruleCount)
+{
+    FILE *in = fopen(mPath.c_str(), "r");
+    if (!in) {
+        warn("Unable to read profile '%s'", mPath.c_str());
+        return false;
+    }
+
+    char name[256];
+    int count;
+    bool ok = fscanf(in, "tjit profile %255s %d", name, &count) == 2 &&
+              name == function && count == ruleCount;
+    mCounts.assign(ruleCount, 0);
+    for (int i = 0; ok && i < ruleCount; i++) {
+        unsigned long long hits;
+        ok = fscanf(in, "%llu", &hits) == 1;
+        mCounts[i] = hits;
+    }
+    fclose(in);
+
+    if (!ok) {
+        warnx("Ignoring profile '%s', which is not for function '%s'",
+              mPath.c_str(), function.c_str());
+        mCounts.clear();
+    }
+    return ok;
+}
+
+void Profile::save(const string &function)
+{
+    FILE *out = fopen(mPath.c_str(), "w");
+    if (!out)
+        err(1, "Unable to write profile '%s'", mPath.c_str());
+
+    fprintf(out, "tjit profile %s %d\n", function.c_str(), (int)mCounts.size());
+    for (vector<uint64_t>::iterator i = mCounts.begin(); i != mCounts.end(); i++)
+        fprintf(out, "%llu\n", (unsigned long long)*i);
+    if (ferror(out) | fclose(out))
+        err(1, "Unable to write profile '%s'", mPath.c_str());
+}
+
+vector<uint64_t> &Profile::getCounts()
+{
+    return mCounts;
+}
@@ -0,0 +1,29 @@
+#ifndef PROFILE_HH__
+#define PROFILE_HH__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/*
+ * Rule hit counts from a training run, kept in a file so later runs can
+ * compile with them. Rules are numbered in the order the machine stores
+ * them, and a profile is only used for the function and rule count it was
+ * written for. The file is text: a header line, then one count per line.
+ */
+class Profile
+{
+public:
+    Profile(const std::string &path);
+
+    bool load(const std::string &function, int ruleCount);
+    void save(const std::string &function);
+
+    std::vector<uint64_t> &getCounts();
+
+private:
+    std::string mPath;
+    std::vector<uint64_t> mCounts;
+};
+
+#endif
@@ -1,12 +1,13 @@
 #include "Rule.hh"
 
-using namespace std;
-
-Rule::Rule(int from, int to, vector<Pattern *> &condition, vector<Pattern *> &action, int delta) :
+Rule::Rule(int from, int to, Pattern *condition, unsigned int conditionSize,
+           Pattern *action, unsigned int actionSize, int delta) :
     mFromState(from),
     mToState(to),
     mCondition(condition),
+    mConditionSize(conditionSize),
     mAction(action),
+    mActionSize(actionSize),
     mDelta(delta)
 {
 }
@@ -21,14 +22,24 @@ int Rule::getToState()
     return mToState;
 }
 
-vector<Pattern *> *Rule::getCondition()
+Pattern *Rule::getCondition()
+{
+    return mCondition;
+}
+
+unsigned int Rule::getConditionSize()
+{
+    return mConditionSize;
+}
+
+Pattern *Rule::getAction()
 {
-    return &mCondition;
+    return mAction;
 }
 
-vector<Pattern *> *Rule::getAction()
+unsigned int Rule::getActionSize()
 {
-    return &mAction;
+    return mActionSize;
 }
 
 int Rule::getDelta()
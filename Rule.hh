@@ -1,27 +1,33 @@
 #ifndef RULE_HH__
 #define RULE_HH__
 
-#include <vector>
-
 #include "Pattern.hh"
 
+/*
+ * A transition of a machine. Its patterns aren't its own: they are runs of
+ * the machine's one array of patterns.
+ */
 class Rule
 {
 public:
-    Rule(int start, int next, std::vector<Pattern *> &cond,
-         std::vector<Pattern *> &act, int delta);
+    Rule(int start, int next, Pattern *cond, unsigned int condSize,
+         Pattern *act, unsigned int actSize, int delta);
 
     int getFromState();
     int getToState();
-    std::vector<Pattern *> *getCondition();
-    std::vector<Pattern *> *getAction();
+    Pattern *getCondition();
+    unsigned int getConditionSize();
+    Pattern *getAction();
+    unsigned int getActionSize();
     int getDelta();
 
 private:
     int mFromState;
     int mToState;
-    std::vector<Pattern *> mCondition;
-    std::vector<Pattern *> mAction;
+    Pattern *mCondition;
+    unsigned int mConditionSize;
+    Pattern *mAction;
+    unsigned int mActionSize;
     int mDelta;
 
 };
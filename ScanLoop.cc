@@ -0,0 +1,206 @@
+#include <cstring>
+#include <emmintrin.h>
+
+#include "ScanLoop.hh"
+
+using namespace std;
+
+// Rules must be in the order they are tested. We look for the first rule
+// that loops back to this state without changing the tape, where it and
+// every rule before it only look at one tape. Whether the loop continues
+// then depends only on the symbol in that tape's cell.
+ScanLoop *ScanLoop::create(int state, vector<Rule *> &rules, int tapeCount)
+{
+    int tape = -1;
+    for (unsigned int k = 0; k < rules.size(); k++) {
+        Rule *rule = rules[k];
+        Pattern *condition = rule->getCondition();
+        unsigned int conditionSize = rule->getConditionSize();
+        for (unsigned int i = 0; i < conditionSize; i++) {
+            if (tape >= 0 && condition[i].getTape() != tape)
+                return 0;
+            tape = condition[i].getTape();
+        }
+
+        bool loops = rule->getToState() == state && rule->getDelta() != 0;
+        Pattern *action = rule->getAction();
+        for (unsigned int i = 0; loops && i < rule->getActionSize(); i++) {
+            bool same = false;
+            for (unsigned int j = 0; j < conditionSize; j++) {
+                if (condition[j].getTape() == action[i].getTape() &&
+                    condition[j].getSymbol() == action[i].getSymbol())
+                    same = true;
+            }
+            loops = same;
+        }
+        if (!loops || tape < 0) {
+            // Nothing after an unconditional rule is ever tested
+            if (conditionSize == 0)
+                return 0;
+            continue;
+        }
+
+        // Work out which symbols select this rule
+        bool stop[256];
+        int stopCount = 0;
+        for (int value = 0; value < 256; value++) {
+            unsigned int selected = k + 1;
+            for (unsigned int r = 0; r <= k; r++) {
+                bool matches = true;
+                Pattern *cond = rules[r]->getCondition();
+                unsigned int condSize = rules[r]->getConditionSize();
+                for (unsigned int i = 0; i < condSize; i++) {
+                    if (cond[i].getSymbol() != value)
+                        matches = false;
+                }
+                if (matches) {
+                    selected = r;
+                    break;
+                }
+            }
+            stop[value] = selected != k;
+            if (stop[value])
+                stopCount++;
+        }
+
+        // The loop never runs, or never ends
+        if (stopCount == 0 || stopCount == 256)
+            return 0;
+
+        return new ScanLoop(tape, tapeCount, rule->getDelta(), stop);
+    }
+    return 0;
+}
+
+ScanLoop::ScanLoop(int tape, int tapeCount, int delta, bool *stop) :
+    mTape(tape),
+    mTapeCount(tapeCount),
+    mDelta(delta)
+{
+    memcpy(mStop, stop, sizeof(mStop));
+
+    // Look for whichever of the stopping or continuing symbols is the
+    // smaller set
+    vector<unsigned char> stopValues;
+    vector<unsigned char> continueValues;
+    for (int value = 0; value < 256; value++) {
+        if (stop[value])
+            stopValues.push_back(value);
+        else
+            continueValues.push_back(value);
+    }
+    mMatchStop = stopValues.size() <= continueValues.size();
+    if (mMatchStop && stopValues.size() <= MAX_VECTOR_VALUES)
+        mValues = stopValues;
+    else if (!mMatchStop && continueValues.size() <= MAX_VECTOR_VALUES)
+        mValues = continueValues;
+
+    // Which bytes of a block belong to our tape, for each alignment of the
+    // block relative to the cells
+    for (int phase = 0; phase < BLOCK; phase++) {
+        mForwardMasks[phase] = 0;
+        mBackwardMasks[phase] = 0;
+        for (int j = 0; j < BLOCK; j++) {
+            if ((phase + j) % mTapeCount == 0)
+                mForwardMasks[phase] |= 1 << j;
+            if ((phase + BLOCK - 1 - j) % mTapeCount == 0)
+                mBackwardMasks[phase] |= 1 << j;
+        }
+    }
+}
+
+// Returns the first cell from head on where the loop stops, or the last
+// cell within the bounds if it doesn't stop before then. With fuel, each
+// cell skipped uses up one unit, and the scan stops when it runs out.
+unsigned char *ScanLoop::scan(unsigned char *head,
+                              unsigned char *lower,
+                              unsigned char *upper,
+                              uint64_t *fuel)
+{
+    if (head < lower || head >= upper)
+        return head;
+
+    if (fuel) {
+        uint64_t step = (mDelta < 0 ? -mDelta : mDelta) * mTapeCount;
+        if (mDelta > 0 && *fuel < (uint64_t)(upper - head) / step)
+            upper = head + *fuel * step + 1;
+        if (mDelta < 0 && *fuel < (uint64_t)(head - lower) / step)
+            lower = head - *fuel * step;
+        unsigned char *next = scan(head, lower, upper);
+        *fuel -= (next > head ? next - head : head - next) / step;
+        return next;
+    }
+    if (mValues.empty() || (mDelta != 1 && mDelta != -1) ||
+        mTapeCount > BLOCK)
+        return scanSlow(head, lower, upper);
+
+    int count = mTapeCount;
+    int offset = 0;
+    if (mDelta == 1) {
+        if (count == 1 && mMatchStop && mValues.size() == 1) {
+            void *found = memchr(head, mValues[0], upper - head);
+            return found ? (unsigned char *)found : upper - 1;
+        }
+
+        unsigned char *start = head + mTape;
+        for (; start + offset + BLOCK <= upper; offset += BLOCK) {
+            unsigned int mask = stopMask(start + offset) &
+                mForwardMasks[offset % count];
+            if (mask)
+                return head + (offset + __builtin_ctz(mask)) / count * count;
+        }
+    } else {
+        if (count == 1 && mMatchStop && mValues.size() == 1) {
+            void *found = memrchr(lower, mValues[0], head - lower + 1);
+            return found ? (unsigned char *)found : lower;
+        }
+
+        unsigned char *end = head + mTape + 1;
+        for (; end - offset - BLOCK >= lower; offset += BLOCK) {
+            unsigned int mask = stopMask(end - offset - BLOCK) &
+                mBackwardMasks[offset % count];
+            if (mask)
+                return head - (offset + BLOCK - 1 - (31 - __builtin_clz(mask))) /
+                    count * count;
+        }
+    }
+
+    // Finish off cell by cell from the first one we haven't checked
+    if (offset == 0)
+        return scanSlow(head, lower, upper);
+    int step = mDelta * count;
+    int cells = (offset + count - 1) / count;
+    unsigned char *next = head + cells * step;
+    if (next < lower || next >= upper)
+        return next - step;
+    return scanSlow(next, lower, upper);
+}
+
+unsigned char *ScanLoop::scanSlow(unsigned char *head,
+                                  unsigned char *lower,
+                                  unsigned char *upper)
+{
+    int step = mDelta * mTapeCount;
+    for (;;) {
+        if (mStop[head[mTape]])
+            return head;
+        unsigned char *next = head + step;
+        if (next < lower || next >= upper)
+            return head;
+        head = next;
+    }
+}
+
+unsigned int ScanLoop::stopMask(unsigned char *block)
+{
+    __m128i data = _mm_loadu_si128((__m128i *)block);
+    __m128i hits = _mm_setzero_si128();
+    for (vector<unsigned char>::iterator i = mValues.begin();
+         i != mValues.end();
+         i++)
+    {
+        hits = _mm_or_si128(hits, _mm_cmpeq_epi8(data, _mm_set1_epi8(*i)));
+    }
+    unsigned int mask = _mm_movemask_epi8(hits);
+    return mMatchStop ? mask : ~mask & 0xFFFF;
+}
@@ -0,0 +1,48 @@
+#ifndef SCANLOOP_HH__
+#define SCANLOOP_HH__
+
+#include <stdint.h>
+#include <vector>
+
+#include "Rule.hh"
+
+/*
+ * A state that keeps looping to itself, moving the head a fixed distance
+ * and writing nothing, until one cell changes, e.g. a seek to the next hash.
+ * Rather than dispatching once per cell, generated code calls scan() on
+ * entry to the state, which skips the head straight to the first cell
+ * where the loop would stop, checking 16 cells at a time with SSE2 where
+ * it can.
+ */
+class ScanLoop
+{
+public:
+    static ScanLoop *create(int state, std::vector<Rule *> &rules, int tapeCount);
+
+    unsigned char *scan(unsigned char *head,
+                        unsigned char *lower,
+                        unsigned char *upper,
+                        uint64_t *fuel = 0);
+
+private:
+    static const int BLOCK = 16;
+    static const int MAX_VECTOR_VALUES = 4;
+
+    ScanLoop(int tape, int tapeCount, int delta, bool *stop);
+
+    int mTape;
+    int mTapeCount;
+    int mDelta;
+    bool mStop[256];
+    bool mMatchStop;
+    std::vector<unsigned char> mValues;
+    unsigned int mForwardMasks[BLOCK];
+    unsigned int mBackwardMasks[BLOCK];
+
+    unsigned char *scanSlow(unsigned char *head,
+                            unsigned char *lower,
+                            unsigned char *upper);
+    unsigned int stopMask(unsigned char *block);
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include <assert.h>
+#include <err.h>
+
+#include "Scheduler.hh"
+
+using namespace std;
+
+extern "C"
+{
+static void *SchedulerWorker(void *scheduler)
+{
+    ((Scheduler *)scheduler)->work();
+    return 0;
+}
+}
+
+Scheduler::Scheduler(CompiledFunction &function, int threads, uint64_t slice) :
+    mFunction(function),
+    mThreads(threads),
+    mSlice(slice),
+    mParams(0),
+    mResults(0),
+    mHalted(0),
+    mCalls(0),
+    mNextCall(0),
+    mInFlight(0)
+{
+    pthread_mutex_init(&mLock, 0);
+    pthread_cond_init(&mReady, 0);
+}
+
+Scheduler::~Scheduler()
+{
+    pthread_cond_destroy(&mReady);
+    pthread_mutex_destroy(&mLock);
+}
+
+// Makes the given number of calls, each on the next arity-sized group of
+// params, putting the results in the same order, along with whether each
+// call halted
+void Scheduler::run(vector<unsigned int> &params,
+                    unsigned int calls,
+                    vector<int> &results,
+                    vector<char> &halted)
+{
+    assert(params.size() == (size_t)calls * mFunction.getArity());
+    mCalls = calls;
+    mNextCall = 0;
+    mInFlight = 0;
+    results.resize(mCalls);
+    halted.resize(mCalls);
+    mParams = &params;
+    mResults = &results;
+    mHalted = &halted;
+
+    vector<pthread_t> workers(mThreads - 1);
+    for (unsigned int i = 0; i < workers.size(); i++) {
+        if (pthread_create(&workers[i], 0, SchedulerWorker, this))
+            errx(1, "Unable to start scheduler thread");
+    }
+    work();
+    for (unsigned int i = 0; i < workers.size(); i++)
+        pthread_join(workers[i], 0);
+}
+
+void Scheduler::work()
+{
+    int arity = mFunction.getArity();
+
+    pthread_mutex_lock(&mLock);
+    for (;;) {
+        // Start new calls while there's room, then take turns
+        unsigned int call;
+        Execution *execution = 0;
+        if (mNextCall < mCalls && mInFlight < MAX_IN_FLIGHT) {
+            call = mNextCall++;
+            mInFlight++;
+        } else if (!mQueue.empty()) {
+            call = mQueue.front().first;
+            execution = mQueue.front().second;
+            mQueue.pop_front();
+        } else if (mInFlight) {
+            // Everything left is being run by other threads
+            pthread_cond_wait(&mReady, &mLock);
+            continue;
+        } else {
+            break;
+        }
+        pthread_mutex_unlock(&mLock);
+
+        if (!execution) {
+            execution = mFunction.start(arity ? &(*mParams)[call * arity]
+                                              : 0);
+        }
+        bool over = mFunction.resume(execution, mSlice);
+        if (over)
+            (*mHalted)[call] = mFunction.finish(execution, &(*mResults)[call]);
+
+        pthread_mutex_lock(&mLock);
+        if (!over)
+            mQueue.push_back(make_pair(call, execution));
+        else
+            mInFlight--;
+        pthread_cond_broadcast(&mReady);
+    }
+    pthread_mutex_unlock(&mLock);
+}
@@ -0,0 +1,52 @@
+#ifndef SCHEDULER_HH__
+#define SCHEDULER_HH__
+
+#include <deque>
+#include <pthread.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "CompiledFunction.hh"
+#include "Execution.hh"
+
+/*
+ * Time-slices many calls of one compiled function across a few threads.
+ * Up to MAX_IN_FLIGHT calls are under way at once, each run for a slice of
+ * fuel at a time and then put to the back of a shared queue, so a short
+ * call finishes promptly however long the calls around it run.
+ */
+class Scheduler
+{
+public:
+    Scheduler(CompiledFunction &function, int threads, uint64_t slice);
+    ~Scheduler();
+
+    void run(std::vector<unsigned int> &params,
+             unsigned int calls,
+             std::vector<int> &results,
+             std::vector<char> &halted);
+    void work();
+
+private:
+    static const unsigned int MAX_IN_FLIGHT = 4096;
+
+    CompiledFunction &mFunction;
+    int mThreads;
+    uint64_t mSlice;
+    std::vector<unsigned int> *mParams;
+    std::vector<int> *mResults;
+    std::vector<char> *mHalted;
+
+    // Everything below is guarded by mLock. Calls before mNextCall have
+    // been started; mInFlight of them haven't finished yet, and those not
+    // being run are queued with their executions.
+    pthread_mutex_t mLock;
+    pthread_cond_t mReady;
+    unsigned int mCalls;
+    unsigned int mNextCall;
+    unsigned int mInFlight;
+    std::deque<std::pair<unsigned int, Execution *> > mQueue;
+};
+
+#endif
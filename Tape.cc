@@ -0,0 +1,287 @@
+#include <algorithm>
+#include <cstring>
+#include <err.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+
+#include "Tape.hh"
+#include "WideAccess.hh"
+
+using namespace std;
+
+__thread Tape *Tape::sActive;
+__thread ExecutableAllocator *Tape::sActiveCode;
+struct sigaction Tape::sPreviousHandler;
+bool Tape::sHandlerInstalled;
+pthread_mutex_t Tape::sHandlerLock = PTHREAD_MUTEX_INITIALIZER;
+
+Tape::Tape(Kind kind, int tapeCount, int cells, int growthFactor, bool recenter,
+           int margin) :
+    mKind(kind),
+    mTapeCount(tapeCount),
+    mGrowthFactor(max(growthFactor, 2)),
+    mRecenter(recenter),
+    mGrowCount(0)
+{
+    size_t size = cells * tapeCount;
+
+    if (kind == CHECKED) {
+        size += 2 * margin * tapeCount;
+        mReserved = (size + WideAccess::PADDING + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+        void *result = mmap(0,
+                            mReserved,
+                            PROT_READ | PROT_WRITE,
+                            MAP_ANONYMOUS | MAP_PRIVATE,
+                            -1,
+                            0);
+        if (result == MAP_FAILED)
+            err(1, "Unable to allocate tape");
+        mBuffer = (unsigned char *)result;
+        memset(mBuffer, 0xffu, mReserved);
+        mOrigin = mBuffer + margin * tapeCount;
+        mPieces.push_back(mReserved);
+        setBounds();
+        return;
+    }
+
+    mReserved = GUARD_RESERVE;
+    void *result = mmap(0,
+                        mReserved,
+                        PROT_NONE,
+                        MAP_ANONYMOUS | MAP_PRIVATE | MAP_NORESERVE,
+                        -1,
+                        0);
+    if (result == MAP_FAILED)
+        err(1, "Unable to reserve tape");
+    mBuffer = (unsigned char *)result;
+    mOrigin = mLower = mUpper = mBuffer + mReserved / 2;
+    commit(mOrigin, mOrigin + size + WideAccess::PADDING);
+
+    // Tapes may be made on several threads at once
+    pthread_mutex_lock(&sHandlerLock);
+    if (!sHandlerInstalled) {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = faultHandler;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGSEGV, &action, &sPreviousHandler))
+            err(1, "Unable to install tape fault handler");
+        sHandlerInstalled = true;
+    }
+    pthread_mutex_unlock(&sHandlerLock);
+}
+
+Tape::~Tape()
+{
+    if (sActive == this)
+        sActive = 0;
+    munmap(mBuffer, mReserved);
+}
+
+Tape::Kind Tape::getKind()
+{
+    return mKind;
+}
+
+unsigned char *Tape::getCell(int cell)
+{
+    return mOrigin + (ptrdiff_t)cell * mTapeCount;
+}
+
+// First and one-past-last cells lying entirely within the bounds
+int Tape::getFirstCell()
+{
+    return -((mOrigin - mLower) / mTapeCount);
+}
+
+int Tape::getEndCell()
+{
+    return (mUpper - mOrigin) / mTapeCount;
+}
+
+unsigned char *Tape::getLowerBound()
+{
+    return mLower;
+}
+
+unsigned char *Tape::getUpperBound()
+{
+    return mUpper;
+}
+
+// Called with the head outside the bounds, or less than margin cells
+// inside them; returns the head, which may have moved
+unsigned char *Tape::grow(unsigned char *head, int margin)
+{
+    ptrdiff_t bytes = margin * mTapeCount;
+    if (mKind == GUARDED) {
+        mGrowCount++;
+        if (head < mLower + bytes)
+            commit(head - bytes, mUpper);
+        else
+            commit(mLower, head + bytes + mTapeCount + WideAccess::PADDING);
+        return head;
+    }
+
+    ptrdiff_t offset = head - mOrigin;
+    while (head < mLower + bytes || head + bytes >= mUpper) {
+        relocate(head < mLower + bytes);
+        head = mOrigin + offset;
+    }
+    return head;
+}
+
+// Move the tape into a mapping mGrowthFactor times the size, with the old
+// pages placed according to the growth policy, given whether the head ran
+// off the lower end. mremap only moves pages within one mapping, so once
+// the tape is made of several, each moves on its own.
+void Tape::relocate(bool below)
+{
+    mGrowCount++;
+    size_t oldSize = mReserved;
+    size_t newSize = oldSize * mGrowthFactor;
+    size_t added = newSize - oldSize;
+    size_t before;
+    if (mRecenter)
+        before = added / 2 / PAGE_SIZE * PAGE_SIZE;
+    else
+        before = below ? added : 0;
+
+    unsigned char *buffer;
+    if (before == 0 && mPieces.size() == 1) {
+        // Extending one mapping at the end, which mremap can do by itself
+        void *result = mremap(mBuffer, oldSize, newSize, MREMAP_MAYMOVE);
+        if (result == MAP_FAILED)
+            err(1, "Unable to grow tape");
+        buffer = (unsigned char *)result;
+        mPieces[0] = newSize;
+    } else {
+        void *result = mmap(0,
+                            newSize,
+                            PROT_READ | PROT_WRITE,
+                            MAP_ANONYMOUS | MAP_PRIVATE,
+                            -1,
+                            0);
+        if (result == MAP_FAILED)
+            err(1, "Unable to grow tape");
+        buffer = (unsigned char *)result;
+
+        size_t offset = 0;
+        for (unsigned int i = 0; i < mPieces.size(); i++) {
+            result = mremap(mBuffer + offset, mPieces[i], mPieces[i],
+                            MREMAP_MAYMOVE | MREMAP_FIXED,
+                            buffer + before + offset);
+            if (result == MAP_FAILED)
+                err(1, "Unable to grow tape");
+            offset += mPieces[i];
+        }
+
+        // The new mapping is split around the pages moved into it
+        if (before)
+            mPieces.insert(mPieces.begin(), before);
+        if (added > before)
+            mPieces.push_back(added - before);
+    }
+
+    // Clear uninitialized tape cells
+    memset(buffer, 0xffu, before);
+    memset(buffer + before + oldSize, 0xffu, added - before);
+
+    mOrigin = buffer + before + (mOrigin - mBuffer);
+    mBuffer = buffer;
+    mReserved = newSize;
+    setBounds();
+}
+
+// Bounds are the outermost whole cells, keeping the padding at the end
+void Tape::setBounds()
+{
+    mLower = mOrigin - (mOrigin - mBuffer) / mTapeCount * mTapeCount;
+    mUpper = mOrigin + (mBuffer + mReserved - WideAccess::PADDING - mOrigin) /
+        mTapeCount * mTapeCount;
+}
+
+// Route faults on this tape from this thread to us. Faults in generated
+// code get R14 and R15 updated to the new bounds on the way out.
+void Tape::activate(ExecutableAllocator *code)
+{
+    sActive = this;
+    sActiveCode = code;
+}
+
+// Make at least [lower, upper) accessible, growing by at least the growth
+// factor so that growth stays amortised
+void Tape::commit(unsigned char *lower, unsigned char *upper)
+{
+    if (lower < mBuffer || upper > mBuffer + mReserved)
+        errx(1, "Tape reservation exhausted");
+
+    ptrdiff_t size = (mUpper - mLower) * (mGrowthFactor - 1);
+    if (lower < mLower && mLower - lower < size)
+        lower = mLower - min(size, mLower - mBuffer);
+    if (upper > mUpper && upper - mUpper < size)
+        upper = mUpper + min(size, mBuffer + mReserved - mUpper);
+
+    lower = mBuffer + (lower - mBuffer) / PAGE_SIZE * PAGE_SIZE;
+    upper = mBuffer + (upper - mBuffer + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+
+    if (lower < mLower || mLower == mUpper) {
+        unsigned char *end = mLower == mUpper ? upper : mLower;
+        if (mprotect(lower, end - lower, PROT_READ | PROT_WRITE))
+            err(1, "Unable to grow tape");
+        memset(lower, 0xffu, end - lower);
+        if (mLower == mUpper)
+            mUpper = upper;
+        mLower = lower;
+    }
+    if (upper > mUpper) {
+        if (mprotect(mUpper, upper - mUpper, PROT_READ | PROT_WRITE))
+            err(1, "Unable to grow tape");
+        memset(mUpper, 0xffu, upper - mUpper);
+        mUpper = upper;
+    }
+}
+
+bool Tape::handleFault(unsigned char *address)
+{
+    if (mKind != GUARDED ||
+        address < mBuffer || address >= mBuffer + mReserved ||
+        (address >= mLower && address < mUpper))
+        return false;
+
+    mGrowCount++;
+    if (address < mLower)
+        commit(address, mUpper);
+    else
+        commit(mLower, address + 1);
+    return true;
+}
+
+// Times the tape has had to grow, counting each fault on a guarded tape
+unsigned int Tape::getGrowCount()
+{
+    return mGrowCount;
+}
+
+void Tape::faultHandler(int sig, siginfo_t *info, void *context)
+{
+    Tape *tape = sActive;
+    if (tape && tape->handleFault((unsigned char *)info->si_addr)) {
+        // The reservation never moves, so RBX is still good
+        ucontext_t *uc = (ucontext_t *)context;
+        void *pc = (void *)uc->uc_mcontext.gregs[REG_RIP];
+        if (sActiveCode && sActiveCode->contains(pc)) {
+            uc->uc_mcontext.gregs[REG_R14] = (greg_t)tape->mLower;
+            uc->uc_mcontext.gregs[REG_R15] = (greg_t)tape->mUpper;
+        }
+        return;
+    }
+
+    // Not ours; put back whoever was there before and let it fault again
+    (void)sig;
+    sigaction(SIGSEGV, &sPreviousHandler, 0);
+    sHandlerInstalled = false;
+}
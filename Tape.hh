@@ -0,0 +1,82 @@
+#ifndef TAPE_HH__
+#define TAPE_HH__
+
+#include <cstddef>
+#include <signal.h>
+#include <vector>
+
+#include "ExecutableAllocator.hh"
+
+/*
+ * Storage for the interleaved tapes. Cell c of tape t lives at
+ * getCell(c)[t], where cell 0 is the first cell of the input; cells to
+ * either side of the input may be added as the machine runs, and a checked
+ * tape can start with a margin of spare cells on both ends. Each time the
+ * tape grows, its size is multiplied by the growth factor.
+ *
+ * A CHECKED tape relies on generated code comparing the head against the
+ * bounds in R14 and R15 and calling grow() when it leaves them, or comes
+ * within a margin of them. It lives in its own mapping, so growing it moves
+ * pages with mremap rather than copying cells. When recentering, the new
+ * space is split evenly between both ends; otherwise it all goes on the end
+ * the head ran off. A GUARDED tape sits in a large reservation of
+ * inaccessible address space instead, and grows from a SIGSEGV handler when
+ * the machine touches a cell outside it, so generated code needs no bounds
+ * checks at all.
+ */
+class Tape
+{
+public:
+    enum Kind {
+        CHECKED,
+        GUARDED
+    };
+
+    Tape(Kind kind, int tapeCount, int cells,
+         int growthFactor = 2, bool recenter = true, int margin = 0);
+    ~Tape();
+
+    Kind getKind();
+    unsigned char *getCell(int cell);
+    int getFirstCell();
+    int getEndCell();
+    unsigned char *getLowerBound();
+    unsigned char *getUpperBound();
+
+    unsigned char *grow(unsigned char *head, int margin = 0);
+    void activate(ExecutableAllocator *code);
+    unsigned int getGrowCount();
+
+private:
+    static const size_t GUARD_RESERVE = 1ul << 32;
+    static const size_t PAGE_SIZE = 4096;
+
+    Kind mKind;
+    int mTapeCount;
+    int mGrowthFactor;
+    bool mRecenter;
+    unsigned char *mBuffer;
+    size_t mReserved;
+
+    // Sizes of the mappings a checked tape is made of, from mBuffer up
+    std::vector<size_t> mPieces;
+
+    unsigned char *mOrigin;
+    unsigned char *mLower;
+    unsigned char *mUpper;
+    unsigned int mGrowCount;
+
+    static __thread Tape *sActive;
+    static __thread ExecutableAllocator *sActiveCode;
+    static struct sigaction sPreviousHandler;
+    static bool sHandlerInstalled;
+    static pthread_mutex_t sHandlerLock;
+
+    void setBounds();
+    void relocate(bool below);
+    void commit(unsigned char *lower, unsigned char *upper);
+    bool handleFault(unsigned char *address);
+    static void faultHandler(int sig, siginfo_t *info, void *context);
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include <assert.h>
+
+#include "WideAccess.hh"
+
+using namespace std;
+
+void WideAccess::emitCompare(MASM &masm,
+                             map<int, int> &cells,
+                             int offset,
+                             vector<MASM::Jump> &failJumps)
+{
+    map<int, int>::iterator i = cells.begin();
+    while (i != cells.end()) {
+        int base = i->first;
+        int last = base;
+        uint64_t mask = 0;
+        uint64_t value = 0;
+        for (; i != cells.end() && i->first < base + MAX_WIDTH; i++) {
+            int shift = 8 * (i->first - base);
+            mask |= (uint64_t)0xFF << shift;
+            value |= (uint64_t)(i->second & 0xFF) << shift;
+            last = i->first;
+        }
+
+        emitMasked(masm, MASM::Location(MASM::RBX, 0, 0, offset + base),
+                   getWidth(last - base + 1), mask, value, false);
+        failJumps.push_back(masm.jump32(MASM::COND_NOT_EQUAL));
+    }
+}
+
+void WideAccess::emitStore(MASM &masm, map<int, int> &cells, int offset)
+{
+    map<int, int>::iterator i = cells.begin();
+    while (i != cells.end()) {
+        int base = i->first;
+        int last = base;
+        uint64_t mask = 0;
+        uint64_t value = 0;
+
+        // Break the window into runs of adjacent cells, each stored whole
+        vector<pair<int, int> > pieces;
+        int runStart = base;
+        for (; i != cells.end() && i->first < base + MAX_WIDTH; i++) {
+            int shift = 8 * (i->first - base);
+            mask |= (uint64_t)0xFF << shift;
+            value |= (uint64_t)(i->second & 0xFF) << shift;
+
+            map<int, int>::iterator next = i;
+            next++;
+            if (next == cells.end() || next->first != i->first + 1 ||
+                next->first >= base + MAX_WIDTH) {
+                int start = runStart;
+                while (start <= i->first) {
+                    int width = MAX_WIDTH;
+                    while (width > i->first - start + 1)
+                        width /= 2;
+                    pieces.push_back(make_pair(start, width));
+                    start += width;
+                }
+                if (next != cells.end())
+                    runStart = next->first;
+            }
+            last = i->first;
+        }
+
+        if (pieces.size() > MAX_STORE_PIECES) {
+            // Too scattered, so read-modify-write the whole window
+            emitMasked(masm, MASM::Location(MASM::RBX, 0, 0, offset + base),
+                       getWidth(last - base + 1), mask, value, true);
+            continue;
+        }
+
+        for (vector<pair<int, int> >::iterator j = pieces.begin();
+             j != pieces.end();
+             j++)
+        {
+            MASM::Location where(MASM::RBX, 0, 0, offset + j->first);
+            uint64_t piece = value >> (8 * (j->first - base));
+            switch (j->second) {
+            case 1:
+                masm.store8(where, piece);
+                break;
+            case 2:
+                masm.store16(where, piece);
+                break;
+            case 4:
+                masm.store32(where, piece);
+                break;
+            default:
+                masm.move64(MASM::RAX, piece);
+                masm.store64(where, MASM::RAX);
+                break;
+            }
+        }
+    }
+}
+
+int WideAccess::getWidth(int span)
+{
+    int width = 1;
+    while (width < span)
+        width *= 2;
+    return width;
+}
+
+// Compare (masked) memory with value, or merge value into it under mask
+void WideAccess::emitMasked(MASM &masm, MASM::Location where, int width,
+                            uint64_t mask, uint64_t value, bool store)
+{
+    uint64_t full = width == 8 ? ~(uint64_t)0 : ((uint64_t)1 << (8 * width)) - 1;
+    assert(!store || mask != full || width == 1);
+
+    if (width == 1) {
+        if (store)
+            masm.store8(where, value);
+        else
+            masm.compare8(where, value);
+        return;
+    }
+
+    if (width == 8) {
+        masm.load64(MASM::RAX, where);
+        if (mask != full) {
+            masm.move64(MASM::RDX, store ? ~mask : mask);
+            masm.and64(MASM::RAX, MASM::RDX);
+        }
+        masm.move64(MASM::RDX, value);
+        if (store) {
+            masm.or64(MASM::RAX, MASM::RDX);
+            masm.store64(where, MASM::RAX);
+        } else {
+            masm.compare64(MASM::RAX, MASM::RDX);
+        }
+        return;
+    }
+
+    if (width == 2)
+        masm.load16ZeroExtend(MASM::RAX, where);
+    else
+        masm.load32(MASM::RAX, where);
+    if (mask != full)
+        masm.and32(MASM::RAX, (store ? ~mask : mask) & full);
+    if (store) {
+        masm.or32(MASM::RAX, value);
+        if (width == 2)
+            masm.store16(where, MASM::RAX);
+        else
+            masm.store32(where, MASM::RAX);
+    } else {
+        masm.compare32(MASM::RAX, value);
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef WIDEACCESS_HH__
+#define WIDEACCESS_HH__
+
+#include <map>
+#include <vector>
+
+#include "MASM.hh"
+
+/*
+ * All tapes at one head position are adjacent bytes, so tests and stores of
+ * several cells can be fused into a few 16, 32 or 64-bit operations. Cells
+ * map tape numbers to symbols, and are addressed relative to RBX plus
+ * offset. These may touch up to seven bytes past the last tape of the row,
+ * so the tape needs that much padding at the end. RAX and RDX are clobbered.
+ */
+class WideAccess
+{
+public:
+    static const int PADDING = 7;
+
+    static void emitCompare(MASM &masm,
+                            std::map<int, int> &cells,
+                            int offset,
+                            std::vector<MASM::Jump> &failJumps);
+    static void emitStore(MASM &masm, std::map<int, int> &cells, int offset);
+
+private:
+    static const int MAX_WIDTH = 8;
+    static const unsigned int MAX_STORE_PIECES = 2;
+
+    static int getWidth(int span);
+    static void emitMasked(MASM &masm, MASM::Location where, int width,
+                           uint64_t mask, uint64_t value, bool store);
+};
+
+#endif
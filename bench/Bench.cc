@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <err.h>
+#include <map>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "CompiledFunction.hh"
+#include "Execution.hh"
+#include "JIT.hh"
+#include "Parser.hh"
+
+using namespace std;
+
+/*
+ * Runs every case of a suite under each JIT mode, checking each result.
+ * A case calls one function with one set of parameters a given number of
+ * times. For each mode we report the time to build the function and make
+ * the first call, the rate of transitions over the rest, and the most tape
+ * and code it used. Compile latency is the time to compile every reachable
+ * state up front, the same for every mode. Transitions are counted by the
+ * interpreter, so every mode is measured against the same count.
+ */
+
+class Case
+{
+public:
+    string file;
+    string function;
+    unsigned int calls;
+    vector<unsigned int> params;
+    int expected;
+};
+
+static const char *MODES[] = {
+    "interp", "tiered", "lazy", "eager", "superblock", "guarded", "oneway"
+};
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Writes s as a JSON string, quotes included
+static void PrintJSONString(const string &s)
+{
+    putchar('"');
+    for (string::const_iterator i = s.begin(); i != s.end(); i++) {
+        unsigned char c = *i;
+        if (c == '"' || c == '\\')
+            printf("\\%c", c);
+        else if (c < 0x20)
+            printf("\\u%04x", c);
+        else
+            putchar(c);
+    }
+    putchar('"');
+}
+
+static string ReadFile(const string &path)
+{
+    FILE *in = fopen(path.c_str(), "r");
+    if (!in)
+        err(1, "Failed to open file '%s'", path.c_str());
+
+    string data;
+    char buf[65536];
+    size_t count;
+    while ((count = fread(buf, 1, sizeof(buf), in)) > 0)
+        data.append(buf, count);
+    if (ferror(in))
+        err(1, "Failed to read file '%s'", path.c_str());
+    fclose(in);
+    return data;
+}
+
+// Lines are "machine function calls params... = expected"; machine files
+// are found next to the suite
+static vector<Case> ReadSuite(const string &path)
+{
+    string dir;
+    size_t slash = path.rfind('/');
+    if (slash != string::npos)
+        dir = path.substr(0, slash + 1);
+
+    vector<Case> cases;
+    istringstream lines(ReadFile(path));
+    string line;
+    for (int lineNumber = 1; getline(lines, line); lineNumber++) {
+        istringstream words(line);
+        string word;
+        Case c;
+        if (!(words >> c.file) || c.file[0] == '#')
+            continue;
+        if (!(words >> c.function >> c.calls))
+            errx(1, "%s:%d: Expected a function and a call count",
+                 path.c_str(), lineNumber);
+        while (words >> word && word != "=")
+            c.params.push_back(strtoul(word.c_str(), NULL, 0));
+        if (word != "=" || !(words >> c.expected) || c.calls == 0)
+            errx(1, "%s:%d: Expected parameters, then = and a result",
+                 path.c_str(), lineNumber);
+        c.file = dir + c.file;
+        cases.push_back(c);
+    }
+    return cases;
+}
+
+static Function *FindFunction(const Case &c)
+{
+    static map<string, map<string, Function *> *> files;
+
+    map<string, Function *> *&funcs = files[c.file];
+    if (!funcs) {
+        funcs = Parser(ReadFile(c.file)).parse();
+        if (!funcs)
+            errx(1, "%s: Parse error", c.file.c_str());
+    }
+    map<string, Function *>::iterator i = funcs->find(c.function);
+    if (i == funcs->end())
+        errx(1, "%s: No such function '%s'", c.file.c_str(),
+             c.function.c_str());
+    if ((int)c.params.size() != i->second->getArity())
+        errx(1, "%s: Expected %d arguments to '%s', got %d", c.file.c_str(),
+             i->second->getArity(), c.function.c_str(), (int)c.params.size());
+    return i->second;
+}
+
+static JIT::Options GetOptions(const string &mode)
+{
+    JIT::Options options;
+    if (mode == "interp") {
+        options.interpretOnly = true;
+    } else if (mode == "lazy") {
+        options.tierUpThreshold = 0;
+        options.superblockThreshold = 0;
+    } else if (mode == "eager") {
+        options.eager = true;
+        options.superblockThreshold = 0;
+    } else if (mode == "superblock") {
+        options.tierUpThreshold = 0;
+        options.superblockThreshold = 16;
+    } else if (mode == "guarded") {
+        options.tapeKind = Tape::GUARDED;
+    } else if (mode == "oneway") {
+        options.tapeRecenter = false;
+    } else if (mode != "tiered") {
+        errx(1, "No such mode '%s'", mode.c_str());
+    }
+    return options;
+}
+
+// Makes one call, returning the state entries it took and noting the tape
+// it used
+static uint64_t Call(CompiledFunction &function, const Case &c,
+                     size_t *peakTape)
+{
+    unsigned int *params = c.params.empty() ? 0
+                                            : (unsigned int *)&c.params[0];
+    Execution *execution = function.start(params);
+    function.resume(execution, UINT64_MAX);
+    uint64_t steps = execution->steps;
+    size_t tape = execution->tape->getUpperBound() -
+                  execution->tape->getLowerBound();
+    *peakTape = max(*peakTape, tape);
+
+    int result;
+    if (!function.finish(execution, &result) || result != c.expected)
+        errx(1, "%s: %s gave %d, not %d", c.file.c_str(), c.function.c_str(),
+             result, c.expected);
+    return steps;
+}
+
+static void usage()
+{
+    printf("Usage: tjit-bench [-j] [-m mode,...] [-r repeats] <suite>\n");
+    printf("  -j  Print one JSON object per case and mode\n");
+    printf("  -m  Run only these modes:");
+    for (unsigned int i = 0; i < sizeof(MODES) / sizeof(MODES[0]); i++)
+        printf(" %s", MODES[i]);
+    printf("\n");
+    printf("  -r  Time the calls this many times, keeping the best\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    bool json = false;
+    int repeats = 3;
+    vector<string> modes(MODES, MODES + sizeof(MODES) / sizeof(MODES[0]));
+
+    int opt;
+    while ((opt = getopt(argc, argv, "jm:r:")) != -1) {
+        switch (opt) {
+        case 'j':
+            json = true;
+            break;
+        case 'm': {
+            modes.clear();
+            istringstream list(optarg);
+            string mode;
+            while (getline(list, mode, ','))
+                modes.push_back(mode);
+            break;
+        }
+        case 'r':
+            repeats = strtol(optarg, NULL, 0);
+            if (repeats < 1)
+                usage();
+            break;
+        default:
+            usage();
+        }
+    }
+    if (argc - optind != 1)
+        usage();
+    for (vector<string>::iterator i = modes.begin(); i != modes.end(); i++)
+        GetOptions(*i);
+
+    vector<Case> cases = ReadSuite(argv[optind]);
+    if (!json) {
+        printf("%-32s %-10s %10s %10s %12s %10s %10s %8s\n",
+               "case", "mode", "compile us", "first us", "transitions",
+               "Mtrans/s", "tape B", "code B");
+    }
+
+    for (vector<Case>::iterator c = cases.begin(); c != cases.end(); c++) {
+        Function *func = FindFunction(*c);
+        ostringstream name;
+        name << c->function;
+        for (unsigned int i = 0; i < c->params.size(); i++)
+            name << (i ? "," : "(") << c->params[i];
+        name << (c->params.empty() ? "()" : ")");
+
+        uint64_t transitions;
+        size_t peakTape = 0;
+        {
+            CompiledFunction reference(func, GetOptions("interp"));
+            transitions = Call(reference, *c, &peakTape);
+        }
+
+        JIT::Options eager = GetOptions("eager");
+        uint64_t start = Now();
+        CompiledFunction *compiled = new CompiledFunction(func, eager);
+        double compileUs = (Now() - start) / 1e3;
+        delete compiled;
+
+        for (vector<string>::iterator mode = modes.begin();
+             mode != modes.end();
+             mode++)
+        {
+            // Everything a cold start costs, then the best of the repeats
+            // of the remaining calls, or of the one call if that's all
+            start = Now();
+            CompiledFunction function(func, GetOptions(*mode));
+            peakTape = 0;
+            Call(function, *c, &peakTape);
+            double firstUs = (Now() - start) / 1e3;
+
+            uint64_t best = UINT64_MAX;
+            unsigned int calls = max(c->calls - 1, 1u);
+            for (int r = 0; r < repeats; r++) {
+                start = Now();
+                for (unsigned int i = 0; i < calls; i++)
+                    Call(function, *c, &peakTape);
+                best = min(best, Now() - start);
+            }
+            double rate = transitions * calls / (best / 1e9);
+
+            if (json) {
+                printf("{\"machine\": ");
+                PrintJSONString(c->file);
+                printf(", \"function\": ");
+                PrintJSONString(c->function);
+                printf(", \"params\": [");
+                for (unsigned int i = 0; i < c->params.size(); i++)
+                    printf("%s%u", i ? ", " : "", c->params[i]);
+                printf("], \"mode\": \"%s\", \"calls\": %u, "
+                       "\"transitions\": %llu, "
+                       "\"transitionsPerSecond\": %.0f, "
+                       "\"compileMicroseconds\": %.1f, "
+                       "\"firstCallMicroseconds\": %.1f, "
+                       "\"peakTapeBytes\": %llu, \"codeBytes\": %llu}\n",
+                       mode->c_str(), calls, (unsigned long long)transitions,
+                       rate, compileUs, firstUs,
+                       (unsigned long long)peakTape,
+                       (unsigned long long)function.getCodeSize());
+            } else {
+                printf("%-32.32s %-10s %10.1f %10.1f %12llu %10.1f "
+                       "%10llu %8llu\n",
+                       name.str().c_str(), mode->c_str(), compileUs, firstUs,
+                       (unsigned long long)transitions, rate / 1e6,
+                       (unsigned long long)peakTape,
+                       (unsigned long long)function.getCodeSize());
+            }
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <err.h>
+#include <map>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "Function.hh"
+#include "JIT.hh"
+#include "MASM.hh"
+#include "Parser.hh"
+
+using namespace std;
+
+/*
+ * Times the steps between reading a machine and running it, which is where
+ * the time goes for many small machines: parsing, compiling one state, and
+ * emitting instructions. Machines are generated with a given number of
+ * states, rules per state, and cells tested per rule, from a fixed seed, so
+ * every run measures the same machines. Each timing is the best of the
+ * repeats.
+ */
+
+static const int COMPILE_STATES = 32;
+static const unsigned int EMIT_BLOCKS = 1 << 20;
+static const unsigned int EMIT_BLOCK_INSTRUCTIONS = 7;
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint32_t Random(uint32_t &seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+// A function "big" of one argument. Each rule tests the first patterns
+// tapes, writes tape 0, and goes anywhere, halting included.
+static string GenerateMachine(int states, int rules, int patterns)
+{
+    uint32_t seed = states * 31 + rules * 7 + patterns;
+    ostringstream out;
+    out << "((big 1 (0 " << states << " (";
+    for (int s = 0; s < states; s++) {
+        for (int r = 0; r < rules; r++) {
+            out << "(" << s << " " << Random(seed) % (states + 1) << " (";
+            for (int p = 0; p < patterns; p++)
+                out << (p ? " (" : "(") << Random(seed) % 16 << " " << p << ")";
+            out << ") ((" << Random(seed) % 4 << " 0)) "
+                << (int)(Random(seed) % 3) - 1 << ")";
+            if (s + 1 < states || r + 1 < rules)
+                out << " ";
+        }
+    }
+    out << ")))))";
+    return out.str();
+}
+
+static Function *ParseMachine(const string &text)
+{
+    map<string, Function *> *funcs = Parser(text).parse();
+    if (!funcs || !funcs->count("big"))
+        errx(1, "Generated machine doesn't parse");
+    return (*funcs)["big"];
+}
+
+static void benchParse(int repeats, bool json)
+{
+    static const int sizes[][3] = {
+        { 100, 10, 2 }, { 1000, 10, 4 }, { 1000, 100, 4 }, { 1000, 100, 8 }
+    };
+
+    if (!json)
+        printf("%-8s %6s %6s %6s %10s %10s %10s\n", "parse", "states",
+               "rules", "cells", "bytes", "MB/s", "Mrules/s");
+    for (unsigned int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        int states = sizes[i][0], rules = sizes[i][1], patterns = sizes[i][2];
+        string text = GenerateMachine(states, rules, patterns);
+
+        uint64_t best = UINT64_MAX;
+        for (int r = 0; r < repeats; r++) {
+            uint64_t start = Now();
+            ParseMachine(text);
+            best = min(best, Now() - start);
+        }
+        double seconds = best / 1e9;
+        double total = (double)states * rules;
+        if (json) {
+            printf("{\"benchmark\": \"parse\", \"states\": %d, "
+                   "\"rulesPerState\": %d, \"cellsPerRule\": %d, "
+                   "\"bytes\": %u, \"nanoseconds\": %llu, "
+                   "\"bytesPerSecond\": %.0f, \"rulesPerSecond\": %.0f}\n",
+                   states, rules, patterns, (unsigned int)text.size(),
+                   (unsigned long long)best, text.size() / seconds,
+                   total / seconds);
+        } else {
+            printf("%-8s %6d %6d %6d %10u %10.1f %10.2f\n", "", states, rules,
+                   patterns, (unsigned int)text.size(),
+                   text.size() / seconds / 1e6, total / seconds / 1e6);
+        }
+    }
+}
+
+// Compiles each state of a fresh JIT in turn, lazily as it would be on
+// first entry, with no superblock profiling
+static void benchCompile(int repeats, bool json)
+{
+    static const int ruleCounts[] = { 1, 4, 16, 64, 256 };
+    static const int patternCounts[] = { 1, 2, 4, 8 };
+
+    JIT::Options options;
+    options.tierUpThreshold = 0;
+    options.superblockThreshold = 0;
+
+    if (!json)
+        printf("%-8s %6s %6s %6s %10s %10s %10s\n", "compile", "states",
+               "rules", "cells", "us/state", "ns/rule", "bytes");
+    for (unsigned int i = 0; i < sizeof(ruleCounts) / sizeof(int); i++) {
+        for (unsigned int j = 0; j < sizeof(patternCounts) / sizeof(int); j++) {
+            int rules = ruleCounts[i], patterns = patternCounts[j];
+            Function *func = ParseMachine(GenerateMachine(COMPILE_STATES,
+                                                          rules, patterns));
+
+            uint64_t best = UINT64_MAX;
+            size_t bytes = 0;
+            for (int r = 0; r < repeats; r++) {
+                JIT jit(func, options);
+                size_t before = jit.getCodeSize();
+                uint64_t start = Now();
+                for (int s = 0; s < COMPILE_STATES; s++)
+                    jit.compile(s);
+                best = min(best, Now() - start);
+                bytes = jit.getCodeSize() - before;
+            }
+            double perState = best / 1e3 / COMPILE_STATES;
+            if (json) {
+                printf("{\"benchmark\": \"compile\", \"states\": %d, "
+                       "\"rulesPerState\": %d, \"cellsPerRule\": %d, "
+                       "\"microsecondsPerState\": %.2f, "
+                       "\"nanosecondsPerRule\": %.1f, "
+                       "\"bytesPerState\": %u}\n",
+                       COMPILE_STATES, rules, patterns, perState,
+                       perState * 1e3 / rules,
+                       (unsigned int)(bytes / COMPILE_STATES));
+            } else {
+                printf("%-8s %6d %6d %6d %10.2f %10.1f %10u\n", "",
+                       COMPILE_STATES, rules, patterns, perState,
+                       perState * 1e3 / rules,
+                       (unsigned int)(bytes / COMPILE_STATES));
+            }
+        }
+    }
+}
+
+// The instructions of a typical dispatch and action: load a cell, branch
+// on it, write one back, move the head and count the rule
+static void benchEmit(int repeats, bool json)
+{
+    size_t size = EMIT_BLOCKS * 64;
+    vector<unsigned char> buffer(size);
+
+    uint64_t best = UINT64_MAX;
+    unsigned int bytes = 0;
+    for (int r = 0; r < repeats; r++) {
+        uint64_t start = Now();
+        MASM masm(&buffer[0], size);
+        for (unsigned int i = 0; i < EMIT_BLOCKS; i++) {
+            MASM::Location cell(MASM::RBX, 0, 0, i % 8);
+            masm.load8ZeroExtend(MASM::RAX, cell);
+            masm.compare32(MASM::RAX, i % 16);
+            MASM::Jump skip = masm.jump32(MASM::COND_EQUAL);
+            masm.store8(cell, i % 4);
+            masm.add32(MASM::RBX, 8);
+            masm.move64(MASM::RAX, (uint64_t)&buffer[0] + i);
+            masm.increment64(MASM::Location(MASM::RAX));
+            masm.link(skip, masm.label());
+        }
+        best = min(best, Now() - start);
+        bytes = masm.getSize();
+        if (masm.hasOverflowed())
+            errx(1, "Emission buffer overflowed");
+    }
+
+    double seconds = best / 1e9;
+    double instructions = (double)EMIT_BLOCKS * EMIT_BLOCK_INSTRUCTIONS;
+    if (json) {
+        printf("{\"benchmark\": \"emit\", \"instructions\": %.0f, "
+               "\"bytes\": %u, \"instructionsPerSecond\": %.0f, "
+               "\"bytesPerSecond\": %.0f}\n",
+               instructions, bytes, instructions / seconds, bytes / seconds);
+    } else {
+        printf("%-8s %10s %10s %10s %10s\n", "emit", "instrs", "bytes",
+               "Minstrs/s", "MB/s");
+        printf("%-8s %10.0f %10u %10.1f %10.1f\n", "", instructions, bytes,
+               instructions / seconds / 1e6, bytes / seconds / 1e6);
+    }
+}
+
+static void usage()
+{
+    printf("Usage: tjit-microbench [-j] [-r repeats] [parse|compile|emit...]\n");
+    printf("  -j  Print one JSON object per measurement\n");
+    printf("  -r  Time each measurement this many times, keeping the best\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    bool json = false;
+    int repeats = 5;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "jr:")) != -1) {
+        switch (opt) {
+        case 'j':
+            json = true;
+            break;
+        case 'r':
+            repeats = strtol(optarg, NULL, 0);
+            if (repeats < 1)
+                usage();
+            break;
+        default:
+            usage();
+        }
+    }
+
+    vector<string> benchmarks(argv + optind, argv + argc);
+    if (benchmarks.empty()) {
+        benchmarks.push_back("parse");
+        benchmarks.push_back("compile");
+        benchmarks.push_back("emit");
+    }
+    for (vector<string>::iterator i = benchmarks.begin();
+         i != benchmarks.end();
+         i++)
+    {
+        if (*i == "parse")
+            benchParse(repeats, json);
+        else if (*i == "compile")
+            benchCompile(repeats, json);
+        else if (*i == "emit")
+            benchEmit(repeats, json);
+        else
+            usage();
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1 @@
+((add 2 (0 1 ((0 2 () ((2 2)) -1) (0 0 ((0 1)) ((0 2)) 1) (0 0 ((1 1)) ((1 2)) 1) (0 0 ((0 0)) ((0 2)) 1) (0 0 ((0 0) (0 1)) ((0 2)) 1) (0 0 ((0 0) (1 1)) ((1 2)) 1) (0 0 ((1 0)) ((1 2)) 1) (0 0 ((1 0) (0 1)) ((1 2)) 1) (0 3 ((1 0) (1 1)) ((0 2)) 1) (3 0 () ((1 2)) 1) (3 0 ((0 1)) ((1 2)) 1) (3 3 ((1 1)) ((0 2)) 1) (3 0 ((0 0)) ((1 2)) 1) (3 0 ((0 0) (0 1)) ((1 2)) 1) (3 3 ((0 0) (1 1)) ((0 2)) 1) (3 3 ((1 0)) ((0 2)) 1) (3 3 ((1 0) (0 1)) ((0 2)) 1) (3 3 ((1 0) (1 1)) ((1 2)) 1) (2 1 ((255 2)) () 1) (2 2 () () -1)))))
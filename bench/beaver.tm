@@ -0,0 +1 @@
+((bb3 0 (0 1 ((0 2 () ((1 1)) 1) (0 3 ((1 1)) ((1 1)) 1) (2 2 () ((1 1)) -1) (2 4 ((1 1)) ((0 1)) 1) (4 4 () ((1 1)) -1) (4 0 ((1 1)) ((1 1)) -1) (3 1 () ((2 0)) 0)))) (bb4 0 (0 1 ((0 2 () ((1 1)) 1) (0 2 ((1 1)) ((1 1)) -1) (2 0 () ((1 1)) -1) (2 3 ((1 1)) ((0 1)) -1) (3 4 () ((1 1)) 1) (3 5 ((1 1)) ((1 1)) -1) (5 5 () ((1 1)) 1) (5 0 ((1 1)) ((0 1)) 1) (4 1 () ((2 0)) 0)))) (bb5 0 (0 1 ((0 2 () ((1 1)) 1) (0 3 ((1 1)) ((1 1)) -1) (2 3 () ((1 1)) 1) (2 2 ((1 1)) ((1 1)) 1) (3 4 () ((1 1)) 1) (3 5 ((1 1)) ((0 1)) -1) (4 0 () ((1 1)) -1) (4 4 ((1 1)) ((1 1)) -1) (5 6 () ((1 1)) 1) (5 0 ((1 1)) ((0 1)) -1) (6 1 () ((2 0)) 0)))))
@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+#
+# Writes the benchmark machines and the suite that runs them. The machines
+# follow tjit's calling convention: parameter i is on tape i in binary,
+# least significant bit first, between hashes (2) starting at cell 0; the
+# head starts on cell 1; at the halt the head must be on the first bit of
+# the result on tape <arity>, which ends in a hash. Blank cells are 255.
+#
+# Rerun this after changing a machine, and commit what it writes.
+
+import os
+
+HASH = 2
+BLANK = 255
+
+class Machine:
+    def __init__(self, name, arity):
+        self.name = name
+        self.arity = arity
+        self.states = {}
+        self.rules = []
+        self.state("start")
+        self.state("halt")
+
+    def state(self, name):
+        if name not in self.states:
+            self.states[name] = len(self.states)
+        return self.states[name]
+
+    # cond and act map tape to symbol
+    def rule(self, frm, to, cond, act, delta):
+        self.rules.append((self.state(frm), self.state(to),
+                           sorted(cond.items()), sorted(act.items()), delta))
+
+    # Move left until the cell of tape holds symbol, then right one cell and
+    # on to the next state
+    def rewind(self, frm, to, tape, symbol=BLANK):
+        self.rule(frm, to, {tape: symbol}, {}, 1)
+        self.rule(frm, frm, {}, {}, -1)
+
+    def text(self):
+        rules = " ".join("(%d %d (%s) (%s) %d)" %
+                         (f, t,
+                          " ".join("(%d %d)" % (s, tp) for tp, s in c),
+                          " ".join("(%d %d)" % (s, tp) for tp, s in a), d)
+                         for f, t, c, a, d in self.rules)
+        return "(%s %d (%d %d (%s)))" % (self.name, self.arity,
+                                         self.states["start"],
+                                         self.states["halt"], rules)
+
+# n + 1, copying the input to the output with the carry added
+def inc():
+    m = Machine("inc", 1)
+    m.rule("start", "start", {0: 1}, {1: 0}, 1)
+    m.rule("start", "copy", {0: 0}, {1: 1}, 1)
+    m.rule("start", "end", {0: HASH}, {1: 1}, 1)
+    for b in (0, 1):
+        m.rule("copy", "copy", {0: b}, {1: b}, 1)
+    m.rule("copy", "rewind", {0: HASH}, {1: HASH}, -1)
+    m.rule("end", "rewind", {}, {1: HASH}, -1)
+    m.rewind("rewind", "halt", 1)
+    return m
+
+# Adds the inputs on tapes 0 .. n - 1 bit by bit into tape n. A tape with no
+# condition in a rule is past the end of its number, so counts as zero:
+# rules with more conditions are tried first.
+def adder(name, n):
+    m = Machine(name, n)
+    digits = [[]]
+    for tape in range(n):
+        digits = [d + [(tape, b)] for d in digits for b in (None, 0, 1)]
+    for carry in range(n):
+        frm = "start" if carry == 0 else "carry%d" % carry
+        for d in digits:
+            cond = dict((t, b) for t, b in d if b is not None)
+            total = carry + sum(cond.values())
+            if not cond and carry == 0:
+                m.rule(frm, "rewind", {}, {n: HASH}, -1)
+            else:
+                to = "start" if total >> 1 == 0 else "carry%d" % (total >> 1)
+                m.rule(frm, to, cond, {n: total & 1}, 1)
+    m.rewind("rewind", "halt", n)
+    return m
+
+# a * b, by adding a into an accumulator on tape 2 and taking one from b
+# until b is zero. Tape 3 marks cell 1, where each pass starts.
+def mul():
+    m = Machine("mul", 2)
+    m.rule("start", "zero", {}, {3: 0}, 0)
+
+    # Is b zero?
+    m.rule("zero", "rewind-dec", {1: 1}, {}, 0)
+    m.rule("zero", "zero", {1: 0}, {}, 1)
+    m.rule("zero", "rewind-finish", {1: HASH}, {}, 0)
+
+    # b - 1
+    m.rule("dec", "dec", {1: 0}, {1: 1}, 1)
+    m.rule("dec", "rewind-add", {1: 1}, {1: 0}, 0)
+
+    # acc + a, the accumulator ending in a hash like any number
+    for carry in (0, 1):
+        frm = "add%d" % carry
+        for a in (None, 0, 1):
+            for c in (None, 0, 1):
+                cond = {}
+                if a is not None:
+                    cond[0] = a
+                if c is not None:
+                    cond[2] = c
+                total = carry + (a or 0) + (c or 0)
+                if not cond and carry == 0:
+                    m.rule(frm, "rewind-zero", {}, {2: HASH}, 0)
+                elif not cond:
+                    m.rule(frm, "add-end", {}, {2: 1}, 1)
+                else:
+                    m.rule(frm, "add%d" % (total >> 1), cond,
+                           {2: total & 1}, 1)
+    m.rule("add-end", "rewind-zero", {}, {2: HASH}, 0)
+
+    for phase in ("dec", "add0", "zero", "finish"):
+        to = phase
+        frm = "rewind-" + ("add" if phase == "add0" else phase)
+        m.rule(frm, to, {3: 0}, {}, 0)
+        m.rule(frm, frm, {}, {}, -1)
+
+    # A product of zero may never have touched the accumulator
+    m.rule("finish", "halt", {2: BLANK}, {2: HASH}, 0)
+    m.rule("finish", "halt", {}, {}, 0)
+    return m
+
+# n, by converting it to unary on tape 2 and back to binary on tape 1.
+# Both halves take time quadratic in n.
+def unary():
+    m = Machine("unary", 1)
+    m.rule("start", "zero", {}, {1: HASH, 3: 0}, 0)
+
+    # Is n zero?
+    m.rule("zero", "rewind-dec", {0: 1}, {}, 0)
+    m.rule("zero", "zero", {0: 0}, {}, 1)
+    m.rule("zero", "rewind-count", {0: HASH}, {}, 0)
+
+    # n - 1, then another mark at the end of the unary tape
+    m.rule("dec", "dec", {0: 0}, {0: 1}, 1)
+    m.rule("dec", "rewind-append", {0: 1}, {0: 0}, 0)
+    m.rule("append", "append", {2: 1}, {}, 1)
+    m.rule("append", "rewind-zero", {}, {2: 1}, 0)
+
+    # Rub out the first mark left and add one to the result
+    m.rule("count", "count", {2: 0}, {}, 1)
+    m.rule("count", "rewind-inc", {2: 1}, {2: 0}, 0)
+    m.rule("count", "rewind-halt", {}, {}, 0)
+    m.rule("inc", "inc", {1: 1}, {1: 0}, 1)
+    m.rule("inc", "rewind-count", {1: 0}, {1: 1}, 0)
+    m.rule("inc", "inc-end", {1: HASH}, {1: 1}, 1)
+    m.rule("inc-end", "rewind-count", {}, {1: HASH}, 0)
+
+    for phase in ("dec", "append", "zero", "count", "inc", "halt"):
+        frm = "rewind-" + phase
+        m.rule(frm, phase, {3: 0}, {}, 0)
+        m.rule(frm, frm, {}, {}, -1)
+    return m
+
+# Busy beaver champions, on tape 1 with blanks as zeros. Each transition is
+# (write, move, next); on halting the result is an empty number on tape 0.
+BEAVERS = {
+    "bb3": {"A": ((1, 1, "B"), (1, 1, "H")),
+            "B": ((1, -1, "B"), (0, 1, "C")),
+            "C": ((1, -1, "C"), (1, -1, "A"))},
+    "bb4": {"A": ((1, 1, "B"), (1, -1, "B")),
+            "B": ((1, -1, "A"), (0, -1, "C")),
+            "C": ((1, 1, "H"), (1, -1, "D")),
+            "D": ((1, 1, "D"), (0, 1, "A"))},
+    "bb5": {"A": ((1, 1, "B"), (1, -1, "C")),
+            "B": ((1, 1, "C"), (1, 1, "B")),
+            "C": ((1, 1, "D"), (0, -1, "E")),
+            "D": ((1, -1, "A"), (1, -1, "D")),
+            "E": ((1, 1, "H"), (0, -1, "A"))},
+}
+
+def beaver(name):
+    m = Machine(name, 0)
+    table = BEAVERS[name]
+    for s in sorted(table):
+        frm = "start" if s == "A" else s
+        for read, (write, move, to) in enumerate(table[s]):
+            to = "start" if to == "A" else "done" if to == "H" else to
+            m.rule(frm, to, {1: 1} if read else {}, {1: write}, move)
+    m.rule("done", "halt", {}, {0: HASH}, 0)
+    return m
+
+# Zero, after sweeping back and forth n + 1 times over a strip of marks on
+# tape 1 that gains a mark at each end per pass, so the tape keeps growing
+# at one end and then the other. Each pass takes one from n as it crosses
+# it, and the pass that finds it zero halts there.
+def zigzag():
+    m = Machine("zigzag", 1)
+    m.rule("start", "right", {}, {}, -1)
+    m.rule("right", "dec", {0: HASH}, {1: 1}, 1)
+    m.rule("right", "right", {}, {}, 1)
+    m.rule("dec", "dec", {0: 0}, {0: 1, 1: 1}, 1)
+    m.rule("dec", "extend-right", {0: 1}, {0: 0, 1: 1}, 1)
+    m.rule("dec", "halt", {0: HASH}, {1: HASH}, 0)
+    m.rule("extend-right", "extend-right", {1: 1}, {}, 1)
+    m.rule("extend-right", "extend-left", {}, {1: 1}, -1)
+    m.rule("extend-left", "extend-left", {1: 1}, {}, -1)
+    m.rule("extend-left", "right", {}, {1: 1}, 1)
+    return m
+
+FILES = {
+    "inc.tm": [inc()],
+    "add.tm": [adder("add", 2)],
+    "mul.tm": [mul()],
+    "unary.tm": [unary()],
+    "beaver.tm": [beaver("bb3"), beaver("bb4"), beaver("bb5")],
+    "wide.tm": [adder("add4", 4), adder("add6", 6)],
+    "zigzag.tm": [zigzag()],
+}
+
+# Machine file, function, calls, parameters, expected result
+SUITE = []
+for bits in (4, 8, 16, 24, 30):
+    n = (1 << bits) - 1
+    SUITE.append(("inc.tm", "inc", 20000, [n], n + 1))
+for bits in (4, 16, 30):
+    a, b = (1 << bits) - 1, (1 << bits) // 3
+    SUITE.append(("add.tm", "add", 20000, [a, b], a + b))
+for a, b in ((3, 5), (1000, 100), (123456, 1000)):
+    SUITE.append(("mul.tm", "mul", 200, [a, b], a * b))
+for n in (10, 100, 1000):
+    SUITE.append(("unary.tm", "unary", 2000000 // (n * n) or 1, [n], n))
+SUITE.append(("beaver.tm", "bb3", 100000, [], 0))
+SUITE.append(("beaver.tm", "bb4", 20000, [], 0))
+SUITE.append(("beaver.tm", "bb5", 1, [], 0))
+SUITE.append(("wide.tm", "add4", 20000, [1 << 29, 12345, 0, 77777],
+              (1 << 29) + 12345 + 77777))
+SUITE.append(("wide.tm", "add6", 20000, [(1 << 28) - 1] * 6,
+              6 * ((1 << 28) - 1)))
+SUITE.append(("zigzag.tm", "zigzag", 1, [8000], 0))
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    for name, machines in sorted(FILES.items()):
+        with open(os.path.join(here, name), "w") as f:
+            f.write("(%s)\n" % " ".join(m.text() for m in machines))
+    with open(os.path.join(here, "suite"), "w") as f:
+        f.write("# Written by corpus.py.\n"
+                "# machine function calls parameters... = expected result\n")
+        for name, function, calls, params, expected in SUITE:
+            f.write("%s %s %d %s= %d\n" %
+                    (name, function, calls,
+                     "".join("%d " % p for p in params), expected))
+
+main()
@@ -0,0 +1 @@
+((inc 1 (0 1 ((0 0 ((1 0)) ((0 1)) 1) (0 2 ((0 0)) ((1 1)) 1) (0 3 ((2 0)) ((1 1)) 1) (2 2 ((0 0)) ((0 1)) 1) (2 2 ((1 0)) ((1 1)) 1) (2 4 ((2 0)) ((2 1)) -1) (3 4 () ((2 1)) -1) (4 1 ((255 1)) () 1) (4 4 () () -1)))))
@@ -0,0 +1 @@
+((mul 2 (0 1 ((0 2 () ((0 3)) 0) (2 3 ((1 1)) () 0) (2 2 ((0 1)) () 1) (2 4 ((2 1)) () 0) (5 5 ((0 1)) ((1 1)) 1) (5 6 ((1 1)) ((0 1)) 0) (7 8 () ((2 2)) 0) (7 7 ((0 2)) ((0 2)) 1) (7 7 ((1 2)) ((1 2)) 1) (7 7 ((0 0)) ((0 2)) 1) (7 7 ((0 0) (0 2)) ((0 2)) 1) (7 7 ((0 0) (1 2)) ((1 2)) 1) (7 7 ((1 0)) ((1 2)) 1) (7 7 ((1 0) (0 2)) ((1 2)) 1) (7 9 ((1 0) (1 2)) ((0 2)) 1) (9 10 () ((1 2)) 1) (9 7 ((0 2)) ((1 2)) 1) (9 9 ((1 2)) ((0 2)) 1) (9 7 ((0 0)) ((1 2)) 1) (9 7 ((0 0) (0 2)) ((1 2)) 1) (9 9 ((0 0) (1 2)) ((0 2)) 1) (9 9 ((1 0)) ((0 2)) 1) (9 9 ((1 0) (0 2)) ((0 2)) 1) (9 9 ((1 0) (1 2)) ((1 2)) 1) (10 8 () ((2 2)) 0) (3 5 ((0 3)) () 0) (3 3 () () -1) (6 7 ((0 3)) () 0) (6 6 () () -1) (8 2 ((0 3)) () 0) (8 8 () () -1) (4 11 ((0 3)) () 0) (4 4 () () -1) (11 1 ((255 2)) ((2 2)) 0) (11 1 () () 0)))))
@@ -0,0 +1 @@
+((unary 1 (0 1 ((0 2 () ((2 1) (0 3)) 0) (2 3 ((1 0)) () 0) (2 2 ((0 0)) () 1) (2 4 ((2 0)) () 0) (5 5 ((0 0)) ((1 0)) 1) (5 6 ((1 0)) ((0 0)) 0) (7 7 ((1 2)) () 1) (7 8 () ((1 2)) 0) (9 9 ((0 2)) () 1) (9 10 ((1 2)) ((0 2)) 0) (9 11 () () 0) (12 12 ((1 1)) ((0 1)) 1) (12 4 ((0 1)) ((1 1)) 0) (12 13 ((2 1)) ((1 1)) 1) (13 4 () ((2 1)) 0) (3 5 ((0 3)) () 0) (3 3 () () -1) (6 7 ((0 3)) () 0) (6 6 () () -1) (8 2 ((0 3)) () 0) (8 8 () () -1) (4 9 ((0 3)) () 0) (4 4 () () -1) (10 12 ((0 3)) () 0) (10 10 () () -1) (11 1 ((0 3)) () 0) (11 11 () () -1)))))
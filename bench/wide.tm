@@ -0,0 +1 @@
+((add4 4 (0 1 ((0 2 () ((2 4)) -1) (0 0 ((0 3)) ((0 4)) 1) (0 0 ((1 3)) ((1 4)) 1) (0 0 ((0 2)) ((0 4)) 1) (0 0 ((0 2) (0 3)) ((0 4)) 1) (0 0 ((0 2) (1 3)) ((1 4)) 1) (0 0 ((1 2)) ((1 4)) 1) (0 0 ((1 2) (0 3)) ((1 4)) 1) (0 3 ((1 2) (1 3)) ((0 4)) 1) (0 0 ((0 1)) ((0 4)) 1) (0 0 ((0 1) (0 3)) ((0 4)) 1) (0 0 ((0 1) (1 3)) ((1 4)) 1) (0 0 ((0 1) (0 2)) ((0 4)) 1) (0 0 ((0 1) (0 2) (0 3)) ((0 4)) 1) (0 0 ((0 1) (0 2) (1 3)) ((1 4)) 1) (0 0 ((0 1) (1 2)) ((1 4)) 1) (0 0 ((0 1) (1 2) (0 3)) ((1 4)) 1) (0 3 ((0 1) (1 2) (1 3)) ((0 4)) 1) (0 0 ((1 1)) ((1 4)) 1) (0 0 ((1 1) (0 3)) ((1 4)) 1) (0 3 ((1 1) (1 3)) ((0 4)) 1) (0 0 ((1 1) (0 2)) ((1 4)) 1) (0 0 ((1 1) (0 2) (0 3)) ((1 4)) 1) (0 3 ((1 1) (0 2) (1 3)) ((0 4)) 1) (0 3 ((1 1) (1 2)) ((0 4)) 1) (0 3 ((1 1) (1 2) (0 3)) ((0 4)) 1) (0 3 ((1 1) (1 2) (1 3)) ((1 4)) 1) (0 0 ((0 0)) ((0 4)) 1) (0 0 ((0 0) (0 3)) ((0 4)) 1) (0 0 ((0 0) (1 3)) ((1 4)) 1) (0 0 ((0 0) (0 2)) ((0 4)) 1) (0 0 ((0 0) (0 2) (0 3)) ((0 4)) 1) (0 0 ((0 0) (0 2) (1 3)) ((1 4)) 1) (0 0 ((0 0) (1 2)) ((1 4)) 1) (0 0 ((0 0) (1 2) (0 3)) ((1 4)) 1) (0 3 ((0 0) (1 2) (1 3)) ((0 4)) 1) (0 0 ((0 0) (0 1)) ((0 4)) 1) (0 0 ((0 0) (0 1) (0 3)) ((0 4)) 1) (0 0 ((0 0) (0 1) (1 3)) ((1 4)) 1) (0 0 ((0 0) (0 1) (0 2)) ((0 4)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3)) ((0 4)) 1) (0 0 ((0 0) (0 1) (0 2) (1 3)) ((1 4)) 1) (0 0 ((0 0) (0 1) (1 2)) ((1 4)) 1) (0 0 ((0 0) (0 1) (1 2) (0 3)) ((1 4)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3)) ((0 4)) 1) (0 0 ((0 0) (1 1)) ((1 4)) 1) (0 0 ((0 0) (1 1) (0 3)) ((1 4)) 1) (0 3 ((0 0) (1 1) (1 3)) ((0 4)) 1) (0 0 ((0 0) (1 1) (0 2)) ((1 4)) 1) (0 0 ((0 0) (1 1) (0 2) (0 3)) ((1 4)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3)) ((0 4)) 1) (0 3 ((0 0) (1 1) (1 2)) ((0 4)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3)) ((0 4)) 1) (0 3 ((0 0) (1 1) (1 2) (1 3)) ((1 4)) 1) (0 0 ((1 0)) ((1 4)) 1) (0 0 ((1 0) (0 3)) ((1 4)) 1) (0 3 ((1 0) (1 3)) ((0 4)) 1) (0 0 ((1 0) (0 2)) ((1 4)) 1) (0 0 ((1 0) (0 2) (0 3)) ((1 4)) 1) (0 3 ((1 0) (0 2) (1 3)) ((0 4)) 1) (0 3 ((1 0) (1 2)) ((0 4)) 1) (0 3 ((1 0) (1 2) (0 3)) ((0 4)) 1) (0 3 ((1 0) (1 2) (1 3)) ((1 4)) 1) (0 0 ((1 0) (0 1)) ((1 4)) 1) (0 0 ((1 0) (0 1) (0 3)) ((1 4)) 1) (0 3 ((1 0) (0 1) (1 3)) ((0 4)) 1) (0 0 ((1 0) (0 1) (0 2)) ((1 4)) 1) (0 0 ((1 0) (0 1) (0 2) (0 3)) ((1 4)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3)) ((0 4)) 1) (0 3 ((1 0) (0 1) (1 2)) ((0 4)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3)) ((0 4)) 1) (0 3 ((1 0) (0 1) (1 2) (1 3)) ((1 4)) 1) (0 3 ((1 0) (1 1)) ((0 4)) 1) (0 3 ((1 0) (1 1) (0 3)) ((0 4)) 1) (0 3 ((1 0) (1 1) (1 3)) ((1 4)) 1) (0 3 ((1 0) (1 1) (0 2)) ((0 4)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3)) ((0 4)) 1) (0 3 ((1 0) (1 1) (0 2) (1 3)) ((1 4)) 1) (0 3 ((1 0) (1 1) (1 2)) ((1 4)) 1) (0 3 ((1 0) (1 1) (1 2) (0 3)) ((1 4)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3)) ((0 4)) 1) (3 0 () ((1 4)) 1) (3 0 ((0 3)) ((1 4)) 1) (3 3 ((1 3)) ((0 4)) 1) (3 0 ((0 2)) ((1 4)) 1) (3 0 ((0 2) (0 3)) ((1 4)) 1) (3 3 ((0 2) (1 3)) ((0 4)) 1) (3 3 ((1 2)) ((0 4)) 1) (3 3 ((1 2) (0 3)) ((0 4)) 1) (3 3 ((1 2) (1 3)) ((1 4)) 1) (3 0 ((0 1)) ((1 4)) 1) (3 0 ((0 1) (0 3)) ((1 4)) 1) (3 3 ((0 1) (1 3)) ((0 4)) 1) (3 0 ((0 1) (0 2)) ((1 4)) 1) (3 0 ((0 1) (0 2) (0 3)) ((1 4)) 1) (3 3 ((0 1) (0 2) (1 3)) ((0 4)) 1) (3 3 ((0 1) (1 2)) ((0 4)) 1) (3 3 ((0 1) (1 2) (0 3)) ((0 4)) 1) (3 3 ((0 1) (1 2) (1 3)) ((1 4)) 1) (3 3 ((1 1)) ((0 4)) 1) (3 3 ((1 1) (0 3)) ((0 4)) 1) (3 3 ((1 1) (1 3)) ((1 4)) 1) (3 3 ((1 1) (0 2)) ((0 4)) 1) (3 3 ((1 1) (0 2) (0 3)) ((0 4)) 1) (3 3 ((1 1) (0 2) (1 3)) ((1 4)) 1) (3 3 ((1 1) (1 2)) ((1 4)) 1) (3 3 ((1 1) (1 2) (0 3)) ((1 4)) 1) (3 4 ((1 1) (1 2) (1 3)) ((0 4)) 1) (3 0 ((0 0)) ((1 4)) 1) (3 0 ((0 0) (0 3)) ((1 4)) 1) (3 3 ((0 0) (1 3)) ((0 4)) 1) (3 0 ((0 0) (0 2)) ((1 4)) 1) (3 0 ((0 0) (0 2) (0 3)) ((1 4)) 1) (3 3 ((0 0) (0 2) (1 3)) ((0 4)) 1) (3 3 ((0 0) (1 2)) ((0 4)) 1) (3 3 ((0 0) (1 2) (0 3)) ((0 4)) 1) (3 3 ((0 0) (1 2) (1 3)) ((1 4)) 1) (3 0 ((0 0) (0 1)) ((1 4)) 1) (3 0 ((0 0) (0 1) (0 3)) ((1 4)) 1) (3 3 ((0 0) (0 1) (1 3)) ((0 4)) 1) (3 0 ((0 0) (0 1) (0 2)) ((1 4)) 1) (3 0 ((0 0) (0 1) (0 2) (0 3)) ((1 4)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3)) ((0 4)) 1) (3 3 ((0 0) (0 1) (1 2)) ((0 4)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3)) ((0 4)) 1) (3 3 ((0 0) (0 1) (1 2) (1 3)) ((1 4)) 1) (3 3 ((0 0) (1 1)) ((0 4)) 1) (3 3 ((0 0) (1 1) (0 3)) ((0 4)) 1) (3 3 ((0 0) (1 1) (1 3)) ((1 4)) 1) (3 3 ((0 0) (1 1) (0 2)) ((0 4)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3)) ((0 4)) 1) (3 3 ((0 0) (1 1) (0 2) (1 3)) ((1 4)) 1) (3 3 ((0 0) (1 1) (1 2)) ((1 4)) 1) (3 3 ((0 0) (1 1) (1 2) (0 3)) ((1 4)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3)) ((0 4)) 1) (3 3 ((1 0)) ((0 4)) 1) (3 3 ((1 0) (0 3)) ((0 4)) 1) (3 3 ((1 0) (1 3)) ((1 4)) 1) (3 3 ((1 0) (0 2)) ((0 4)) 1) (3 3 ((1 0) (0 2) (0 3)) ((0 4)) 1) (3 3 ((1 0) (0 2) (1 3)) ((1 4)) 1) (3 3 ((1 0) (1 2)) ((1 4)) 1) (3 3 ((1 0) (1 2) (0 3)) ((1 4)) 1) (3 4 ((1 0) (1 2) (1 3)) ((0 4)) 1) (3 3 ((1 0) (0 1)) ((0 4)) 1) (3 3 ((1 0) (0 1) (0 3)) ((0 4)) 1) (3 3 ((1 0) (0 1) (1 3)) ((1 4)) 1) (3 3 ((1 0) (0 1) (0 2)) ((0 4)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3)) ((0 4)) 1) (3 3 ((1 0) (0 1) (0 2) (1 3)) ((1 4)) 1) (3 3 ((1 0) (0 1) (1 2)) ((1 4)) 1) (3 3 ((1 0) (0 1) (1 2) (0 3)) ((1 4)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3)) ((0 4)) 1) (3 3 ((1 0) (1 1)) ((1 4)) 1) (3 3 ((1 0) (1 1) (0 3)) ((1 4)) 1) (3 4 ((1 0) (1 1) (1 3)) ((0 4)) 1) (3 3 ((1 0) (1 1) (0 2)) ((1 4)) 1) (3 3 ((1 0) (1 1) (0 2) (0 3)) ((1 4)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3)) ((0 4)) 1) (3 4 ((1 0) (1 1) (1 2)) ((0 4)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3)) ((0 4)) 1) (3 4 ((1 0) (1 1) (1 2) (1 3)) ((1 4)) 1) (4 3 () ((0 4)) 1) (4 3 ((0 3)) ((0 4)) 1) (4 3 ((1 3)) ((1 4)) 1) (4 3 ((0 2)) ((0 4)) 1) (4 3 ((0 2) (0 3)) ((0 4)) 1) (4 3 ((0 2) (1 3)) ((1 4)) 1) (4 3 ((1 2)) ((1 4)) 1) (4 3 ((1 2) (0 3)) ((1 4)) 1) (4 4 ((1 2) (1 3)) ((0 4)) 1) (4 3 ((0 1)) ((0 4)) 1) (4 3 ((0 1) (0 3)) ((0 4)) 1) (4 3 ((0 1) (1 3)) ((1 4)) 1) (4 3 ((0 1) (0 2)) ((0 4)) 1) (4 3 ((0 1) (0 2) (0 3)) ((0 4)) 1) (4 3 ((0 1) (0 2) (1 3)) ((1 4)) 1) (4 3 ((0 1) (1 2)) ((1 4)) 1) (4 3 ((0 1) (1 2) (0 3)) ((1 4)) 1) (4 4 ((0 1) (1 2) (1 3)) ((0 4)) 1) (4 3 ((1 1)) ((1 4)) 1) (4 3 ((1 1) (0 3)) ((1 4)) 1) (4 4 ((1 1) (1 3)) ((0 4)) 1) (4 3 ((1 1) (0 2)) ((1 4)) 1) (4 3 ((1 1) (0 2) (0 3)) ((1 4)) 1) (4 4 ((1 1) (0 2) (1 3)) ((0 4)) 1) (4 4 ((1 1) (1 2)) ((0 4)) 1) (4 4 ((1 1) (1 2) (0 3)) ((0 4)) 1) (4 4 ((1 1) (1 2) (1 3)) ((1 4)) 1) (4 3 ((0 0)) ((0 4)) 1) (4 3 ((0 0) (0 3)) ((0 4)) 1) (4 3 ((0 0) (1 3)) ((1 4)) 1) (4 3 ((0 0) (0 2)) ((0 4)) 1) (4 3 ((0 0) (0 2) (0 3)) ((0 4)) 1) (4 3 ((0 0) (0 2) (1 3)) ((1 4)) 1) (4 3 ((0 0) (1 2)) ((1 4)) 1) (4 3 ((0 0) (1 2) (0 3)) ((1 4)) 1) (4 4 ((0 0) (1 2) (1 3)) ((0 4)) 1) (4 3 ((0 0) (0 1)) ((0 4)) 1) (4 3 ((0 0) (0 1) (0 3)) ((0 4)) 1) (4 3 ((0 0) (0 1) (1 3)) ((1 4)) 1) (4 3 ((0 0) (0 1) (0 2)) ((0 4)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3)) ((0 4)) 1) (4 3 ((0 0) (0 1) (0 2) (1 3)) ((1 4)) 1) (4 3 ((0 0) (0 1) (1 2)) ((1 4)) 1) (4 3 ((0 0) (0 1) (1 2) (0 3)) ((1 4)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3)) ((0 4)) 1) (4 3 ((0 0) (1 1)) ((1 4)) 1) (4 3 ((0 0) (1 1) (0 3)) ((1 4)) 1) (4 4 ((0 0) (1 1) (1 3)) ((0 4)) 1) (4 3 ((0 0) (1 1) (0 2)) ((1 4)) 1) (4 3 ((0 0) (1 1) (0 2) (0 3)) ((1 4)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3)) ((0 4)) 1) (4 4 ((0 0) (1 1) (1 2)) ((0 4)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3)) ((0 4)) 1) (4 4 ((0 0) (1 1) (1 2) (1 3)) ((1 4)) 1) (4 3 ((1 0)) ((1 4)) 1) (4 3 ((1 0) (0 3)) ((1 4)) 1) (4 4 ((1 0) (1 3)) ((0 4)) 1) (4 3 ((1 0) (0 2)) ((1 4)) 1) (4 3 ((1 0) (0 2) (0 3)) ((1 4)) 1) (4 4 ((1 0) (0 2) (1 3)) ((0 4)) 1) (4 4 ((1 0) (1 2)) ((0 4)) 1) (4 4 ((1 0) (1 2) (0 3)) ((0 4)) 1) (4 4 ((1 0) (1 2) (1 3)) ((1 4)) 1) (4 3 ((1 0) (0 1)) ((1 4)) 1) (4 3 ((1 0) (0 1) (0 3)) ((1 4)) 1) (4 4 ((1 0) (0 1) (1 3)) ((0 4)) 1) (4 3 ((1 0) (0 1) (0 2)) ((1 4)) 1) (4 3 ((1 0) (0 1) (0 2) (0 3)) ((1 4)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3)) ((0 4)) 1) (4 4 ((1 0) (0 1) (1 2)) ((0 4)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3)) ((0 4)) 1) (4 4 ((1 0) (0 1) (1 2) (1 3)) ((1 4)) 1) (4 4 ((1 0) (1 1)) ((0 4)) 1) (4 4 ((1 0) (1 1) (0 3)) ((0 4)) 1) (4 4 ((1 0) (1 1) (1 3)) ((1 4)) 1) (4 4 ((1 0) (1 1) (0 2)) ((0 4)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3)) ((0 4)) 1) (4 4 ((1 0) (1 1) (0 2) (1 3)) ((1 4)) 1) (4 4 ((1 0) (1 1) (1 2)) ((1 4)) 1) (4 4 ((1 0) (1 1) (1 2) (0 3)) ((1 4)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3)) ((0 4)) 1) (5 3 () ((1 4)) 1) (5 3 ((0 3)) ((1 4)) 1) (5 4 ((1 3)) ((0 4)) 1) (5 3 ((0 2)) ((1 4)) 1) (5 3 ((0 2) (0 3)) ((1 4)) 1) (5 4 ((0 2) (1 3)) ((0 4)) 1) (5 4 ((1 2)) ((0 4)) 1) (5 4 ((1 2) (0 3)) ((0 4)) 1) (5 4 ((1 2) (1 3)) ((1 4)) 1) (5 3 ((0 1)) ((1 4)) 1) (5 3 ((0 1) (0 3)) ((1 4)) 1) (5 4 ((0 1) (1 3)) ((0 4)) 1) (5 3 ((0 1) (0 2)) ((1 4)) 1) (5 3 ((0 1) (0 2) (0 3)) ((1 4)) 1) (5 4 ((0 1) (0 2) (1 3)) ((0 4)) 1) (5 4 ((0 1) (1 2)) ((0 4)) 1) (5 4 ((0 1) (1 2) (0 3)) ((0 4)) 1) (5 4 ((0 1) (1 2) (1 3)) ((1 4)) 1) (5 4 ((1 1)) ((0 4)) 1) (5 4 ((1 1) (0 3)) ((0 4)) 1) (5 4 ((1 1) (1 3)) ((1 4)) 1) (5 4 ((1 1) (0 2)) ((0 4)) 1) (5 4 ((1 1) (0 2) (0 3)) ((0 4)) 1) (5 4 ((1 1) (0 2) (1 3)) ((1 4)) 1) (5 4 ((1 1) (1 2)) ((1 4)) 1) (5 4 ((1 1) (1 2) (0 3)) ((1 4)) 1) (5 5 ((1 1) (1 2) (1 3)) ((0 4)) 1) (5 3 ((0 0)) ((1 4)) 1) (5 3 ((0 0) (0 3)) ((1 4)) 1) (5 4 ((0 0) (1 3)) ((0 4)) 1) (5 3 ((0 0) (0 2)) ((1 4)) 1) (5 3 ((0 0) (0 2) (0 3)) ((1 4)) 1) (5 4 ((0 0) (0 2) (1 3)) ((0 4)) 1) (5 4 ((0 0) (1 2)) ((0 4)) 1) (5 4 ((0 0) (1 2) (0 3)) ((0 4)) 1) (5 4 ((0 0) (1 2) (1 3)) ((1 4)) 1) (5 3 ((0 0) (0 1)) ((1 4)) 1) (5 3 ((0 0) (0 1) (0 3)) ((1 4)) 1) (5 4 ((0 0) (0 1) (1 3)) ((0 4)) 1) (5 3 ((0 0) (0 1) (0 2)) ((1 4)) 1) (5 3 ((0 0) (0 1) (0 2) (0 3)) ((1 4)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3)) ((0 4)) 1) (5 4 ((0 0) (0 1) (1 2)) ((0 4)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3)) ((0 4)) 1) (5 4 ((0 0) (0 1) (1 2) (1 3)) ((1 4)) 1) (5 4 ((0 0) (1 1)) ((0 4)) 1) (5 4 ((0 0) (1 1) (0 3)) ((0 4)) 1) (5 4 ((0 0) (1 1) (1 3)) ((1 4)) 1) (5 4 ((0 0) (1 1) (0 2)) ((0 4)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3)) ((0 4)) 1) (5 4 ((0 0) (1 1) (0 2) (1 3)) ((1 4)) 1) (5 4 ((0 0) (1 1) (1 2)) ((1 4)) 1) (5 4 ((0 0) (1 1) (1 2) (0 3)) ((1 4)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3)) ((0 4)) 1) (5 4 ((1 0)) ((0 4)) 1) (5 4 ((1 0) (0 3)) ((0 4)) 1) (5 4 ((1 0) (1 3)) ((1 4)) 1) (5 4 ((1 0) (0 2)) ((0 4)) 1) (5 4 ((1 0) (0 2) (0 3)) ((0 4)) 1) (5 4 ((1 0) (0 2) (1 3)) ((1 4)) 1) (5 4 ((1 0) (1 2)) ((1 4)) 1) (5 4 ((1 0) (1 2) (0 3)) ((1 4)) 1) (5 5 ((1 0) (1 2) (1 3)) ((0 4)) 1) (5 4 ((1 0) (0 1)) ((0 4)) 1) (5 4 ((1 0) (0 1) (0 3)) ((0 4)) 1) (5 4 ((1 0) (0 1) (1 3)) ((1 4)) 1) (5 4 ((1 0) (0 1) (0 2)) ((0 4)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3)) ((0 4)) 1) (5 4 ((1 0) (0 1) (0 2) (1 3)) ((1 4)) 1) (5 4 ((1 0) (0 1) (1 2)) ((1 4)) 1) (5 4 ((1 0) (0 1) (1 2) (0 3)) ((1 4)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3)) ((0 4)) 1) (5 4 ((1 0) (1 1)) ((1 4)) 1) (5 4 ((1 0) (1 1) (0 3)) ((1 4)) 1) (5 5 ((1 0) (1 1) (1 3)) ((0 4)) 1) (5 4 ((1 0) (1 1) (0 2)) ((1 4)) 1) (5 4 ((1 0) (1 1) (0 2) (0 3)) ((1 4)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3)) ((0 4)) 1) (5 5 ((1 0) (1 1) (1 2)) ((0 4)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3)) ((0 4)) 1) (5 5 ((1 0) (1 1) (1 2) (1 3)) ((1 4)) 1) (2 1 ((255 4)) () 1) (2 2 () () -1)))) (add6 6 (0 1 ((0 2 () ((2 6)) -1) (0 0 ((0 5)) ((0 6)) 1) (0 0 ((1 5)) ((1 6)) 1) (0 0 ((0 4)) ((0 6)) 1) (0 0 ((0 4) (0 5)) ((0 6)) 1) (0 0 ((0 4) (1 5)) ((1 6)) 1) (0 0 ((1 4)) ((1 6)) 1) (0 0 ((1 4) (0 5)) ((1 6)) 1) (0 3 ((1 4) (1 5)) ((0 6)) 1) (0 0 ((0 3)) ((0 6)) 1) (0 0 ((0 3) (0 5)) ((0 6)) 1) (0 0 ((0 3) (1 5)) ((1 6)) 1) (0 0 ((0 3) (0 4)) ((0 6)) 1) (0 0 ((0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 3) (1 4)) ((1 6)) 1) (0 0 ((0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((1 3)) ((1 6)) 1) (0 0 ((1 3) (0 5)) ((1 6)) 1) (0 3 ((1 3) (1 5)) ((0 6)) 1) (0 0 ((1 3) (0 4)) ((1 6)) 1) (0 0 ((1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 3) (1 4)) ((0 6)) 1) (0 3 ((1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 2)) ((0 6)) 1) (0 0 ((0 2) (0 5)) ((0 6)) 1) (0 0 ((0 2) (1 5)) ((1 6)) 1) (0 0 ((0 2) (0 4)) ((0 6)) 1) (0 0 ((0 2) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 2) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 2) (1 4)) ((1 6)) 1) (0 0 ((0 2) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 2) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 2) (0 3)) ((0 6)) 1) (0 0 ((0 2) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 2) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 2) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 2) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 2) (1 3)) ((1 6)) 1) (0 0 ((0 2) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 2) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 2) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 2) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 2)) ((1 6)) 1) (0 0 ((1 2) (0 5)) ((1 6)) 1) (0 3 ((1 2) (1 5)) ((0 6)) 1) (0 0 ((1 2) (0 4)) ((1 6)) 1) (0 0 ((1 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 2) (1 4)) ((0 6)) 1) (0 3 ((1 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 2) (0 3)) ((1 6)) 1) (0 0 ((1 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 2) (1 3)) ((0 6)) 1) (0 3 ((1 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 1)) ((0 6)) 1) (0 0 ((0 1) (0 5)) ((0 6)) 1) (0 0 ((0 1) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 4)) ((0 6)) 1) (0 0 ((0 1) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (1 4)) ((1 6)) 1) (0 0 ((0 1) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 1) (0 3)) ((0 6)) 1) (0 0 ((0 1) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 1) (1 3)) ((1 6)) 1) (0 0 ((0 1) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 1) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 1) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 2)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 2) (0 4)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 2) (1 4)) ((1 6)) 1) (0 0 ((0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 3)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (1 3)) ((1 6)) 1) (0 0 ((0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (1 2)) ((1 6)) 1) (0 0 ((0 1) (1 2) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (1 5)) ((0 6)) 1) (0 0 ((0 1) (1 2) (0 4)) ((1 6)) 1) (0 0 ((0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 4)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 1) (1 2) (0 3)) ((1 6)) 1) (0 0 ((0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (1 3)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((1 1)) ((1 6)) 1) (0 0 ((1 1) (0 5)) ((1 6)) 1) (0 3 ((1 1) (1 5)) ((0 6)) 1) (0 0 ((1 1) (0 4)) ((1 6)) 1) (0 0 ((1 1) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (1 4)) ((0 6)) 1) (0 3 ((1 1) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 1) (0 3)) ((1 6)) 1) (0 0 ((1 1) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 1) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 3)) ((0 6)) 1) (0 3 ((1 1) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((1 1) (0 2)) ((1 6)) 1) (0 0 ((1 1) (0 2) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (1 5)) ((0 6)) 1) (0 0 ((1 1) (0 2) (0 4)) ((1 6)) 1) (0 0 ((1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 4)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 1) (0 2) (0 3)) ((1 6)) 1) (0 0 ((1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (1 3)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (1 2)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 2) (0 4)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 2) (1 4)) ((1 6)) 1) (0 3 ((1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 3)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (0 3 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (1 3)) ((1 6)) 1) (0 3 ((1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (0 4 ((1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (0 3 ((1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (0 3 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (0 4 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0)) ((0 6)) 1) (0 0 ((0 0) (0 5)) ((0 6)) 1) (0 0 ((0 0) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (1 4)) ((1 6)) 1) (0 0 ((0 0) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 3)) ((0 6)) 1) (0 0 ((0 0) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 3)) ((1 6)) 1) (0 0 ((0 0) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 2)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 2) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 2) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 3)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (1 3)) ((1 6)) 1) (0 0 ((0 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (1 2)) ((1 6)) 1) (0 0 ((0 0) (1 2) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 2) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (1 2) (0 3)) ((1 6)) 1) (0 0 ((0 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (1 3)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 3)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (1 3)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 3)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 3)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1) (0 2)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (0 3 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0)) ((1 6)) 1) (0 0 ((1 0) (0 5)) ((1 6)) 1) (0 3 ((1 0) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 4)) ((0 6)) 1) (0 3 ((1 0) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0) (0 3)) ((1 6)) 1) (0 0 ((1 0) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 3)) ((0 6)) 1) (0 3 ((1 0) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 2)) ((1 6)) 1) (0 0 ((1 0) (0 2) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 2) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0) (0 2) (0 3)) ((1 6)) 1) (0 0 ((1 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (1 3)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 2)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 2) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 2) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 3)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (1 3)) ((1 6)) 1) (0 3 ((1 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (0 3 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (0 4 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0) (0 1)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 1) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 3)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 3)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 1) (0 2)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (0 0 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (0 3 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 3)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (1 3)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (0 3 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (0 4 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (0 5 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 () ((1 6)) 1) (3 0 ((0 5)) ((1 6)) 1) (3 3 ((1 5)) ((0 6)) 1) (3 0 ((0 4)) ((1 6)) 1) (3 0 ((0 4) (0 5)) ((1 6)) 1) (3 3 ((0 4) (1 5)) ((0 6)) 1) (3 3 ((1 4)) ((0 6)) 1) (3 3 ((1 4) (0 5)) ((0 6)) 1) (3 3 ((1 4) (1 5)) ((1 6)) 1) (3 0 ((0 3)) ((1 6)) 1) (3 0 ((0 3) (0 5)) ((1 6)) 1) (3 3 ((0 3) (1 5)) ((0 6)) 1) (3 0 ((0 3) (0 4)) ((1 6)) 1) (3 0 ((0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 3) (1 4)) ((0 6)) 1) (3 3 ((0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 3)) ((0 6)) 1) (3 3 ((1 3) (0 5)) ((0 6)) 1) (3 3 ((1 3) (1 5)) ((1 6)) 1) (3 3 ((1 3) (0 4)) ((0 6)) 1) (3 3 ((1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 3) (1 4)) ((1 6)) 1) (3 3 ((1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 ((0 2)) ((1 6)) 1) (3 0 ((0 2) (0 5)) ((1 6)) 1) (3 3 ((0 2) (1 5)) ((0 6)) 1) (3 0 ((0 2) (0 4)) ((1 6)) 1) (3 0 ((0 2) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 2) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 2) (1 4)) ((0 6)) 1) (3 3 ((0 2) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 2) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 2) (0 3)) ((1 6)) 1) (3 0 ((0 2) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 2) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 2) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 2) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 2) (1 3)) ((0 6)) 1) (3 3 ((0 2) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 2) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 2) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 2) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 2)) ((0 6)) 1) (3 3 ((1 2) (0 5)) ((0 6)) 1) (3 3 ((1 2) (1 5)) ((1 6)) 1) (3 3 ((1 2) (0 4)) ((0 6)) 1) (3 3 ((1 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 2) (1 4)) ((1 6)) 1) (3 3 ((1 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 2) (0 3)) ((0 6)) 1) (3 3 ((1 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 2) (1 3)) ((1 6)) 1) (3 3 ((1 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 1)) ((1 6)) 1) (3 0 ((0 1) (0 5)) ((1 6)) 1) (3 3 ((0 1) (1 5)) ((0 6)) 1) (3 0 ((0 1) (0 4)) ((1 6)) 1) (3 0 ((0 1) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (1 4)) ((0 6)) 1) (3 3 ((0 1) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 1) (0 3)) ((1 6)) 1) (3 0 ((0 1) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 1) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 3)) ((0 6)) 1) (3 3 ((0 1) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 ((0 1) (0 2)) ((1 6)) 1) (3 0 ((0 1) (0 2) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (1 5)) ((0 6)) 1) (3 0 ((0 1) (0 2) (0 4)) ((1 6)) 1) (3 0 ((0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 4)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 1) (0 2) (0 3)) ((1 6)) 1) (3 0 ((0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (1 3)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (1 2)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 2) (0 4)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 2) (1 4)) ((1 6)) 1) (3 3 ((0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 3)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (1 3)) ((1 6)) 1) (3 3 ((0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 1)) ((0 6)) 1) (3 3 ((1 1) (0 5)) ((0 6)) 1) (3 3 ((1 1) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 4)) ((0 6)) 1) (3 3 ((1 1) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (1 4)) ((1 6)) 1) (3 3 ((1 1) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 1) (0 3)) ((0 6)) 1) (3 3 ((1 1) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 1) (1 3)) ((1 6)) 1) (3 3 ((1 1) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 1) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 1) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 2)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 2) (0 4)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 2) (1 4)) ((1 6)) 1) (3 3 ((1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 3)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (1 3)) ((1 6)) 1) (3 3 ((1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (1 2)) ((1 6)) 1) (3 3 ((1 1) (1 2) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (1 5)) ((0 6)) 1) (3 3 ((1 1) (1 2) (0 4)) ((1 6)) 1) (3 3 ((1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 4)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 1) (1 2) (0 3)) ((1 6)) 1) (3 3 ((1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (3 3 ((1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (3 3 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (3 4 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (1 3)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (3 4 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 ((0 0)) ((1 6)) 1) (3 0 ((0 0) (0 5)) ((1 6)) 1) (3 3 ((0 0) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 4)) ((0 6)) 1) (3 3 ((0 0) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 0) (0 3)) ((1 6)) 1) (3 0 ((0 0) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 3)) ((0 6)) 1) (3 3 ((0 0) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 2)) ((1 6)) 1) (3 0 ((0 0) (0 2) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 2) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 0) (0 2) (0 3)) ((1 6)) 1) (3 0 ((0 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (1 3)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 2)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 2) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 2) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 3)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (1 3)) ((1 6)) 1) (3 3 ((0 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 0) (0 1)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 1) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 3)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 3)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 1) (0 2)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (3 0 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 3)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (1 3)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (3 3 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (3 4 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0)) ((0 6)) 1) (3 3 ((1 0) (0 5)) ((0 6)) 1) (3 3 ((1 0) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (1 4)) ((1 6)) 1) (3 3 ((1 0) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 3)) ((0 6)) 1) (3 3 ((1 0) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 3)) ((1 6)) 1) (3 3 ((1 0) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 2)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 2) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 2) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 3)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (1 3)) ((1 6)) 1) (3 3 ((1 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (1 2)) ((1 6)) 1) (3 3 ((1 0) (1 2) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 2) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (1 2) (0 3)) ((1 6)) 1) (3 3 ((1 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (1 3)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (3 4 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 3)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (1 3)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (3 4 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 3)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 3)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1) (0 2)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (3 3 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (3 4 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (3 4 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (3 5 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 () ((0 6)) 1) (4 3 ((0 5)) ((0 6)) 1) (4 3 ((1 5)) ((1 6)) 1) (4 3 ((0 4)) ((0 6)) 1) (4 3 ((0 4) (0 5)) ((0 6)) 1) (4 3 ((0 4) (1 5)) ((1 6)) 1) (4 3 ((1 4)) ((1 6)) 1) (4 3 ((1 4) (0 5)) ((1 6)) 1) (4 4 ((1 4) (1 5)) ((0 6)) 1) (4 3 ((0 3)) ((0 6)) 1) (4 3 ((0 3) (0 5)) ((0 6)) 1) (4 3 ((0 3) (1 5)) ((1 6)) 1) (4 3 ((0 3) (0 4)) ((0 6)) 1) (4 3 ((0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 3) (1 4)) ((1 6)) 1) (4 3 ((0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((1 3)) ((1 6)) 1) (4 3 ((1 3) (0 5)) ((1 6)) 1) (4 4 ((1 3) (1 5)) ((0 6)) 1) (4 3 ((1 3) (0 4)) ((1 6)) 1) (4 3 ((1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 3) (1 4)) ((0 6)) 1) (4 4 ((1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 2)) ((0 6)) 1) (4 3 ((0 2) (0 5)) ((0 6)) 1) (4 3 ((0 2) (1 5)) ((1 6)) 1) (4 3 ((0 2) (0 4)) ((0 6)) 1) (4 3 ((0 2) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 2) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 2) (1 4)) ((1 6)) 1) (4 3 ((0 2) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 2) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 2) (0 3)) ((0 6)) 1) (4 3 ((0 2) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 2) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 2) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 2) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 2) (1 3)) ((1 6)) 1) (4 3 ((0 2) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 2) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 2) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 2) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 2)) ((1 6)) 1) (4 3 ((1 2) (0 5)) ((1 6)) 1) (4 4 ((1 2) (1 5)) ((0 6)) 1) (4 3 ((1 2) (0 4)) ((1 6)) 1) (4 3 ((1 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 2) (1 4)) ((0 6)) 1) (4 4 ((1 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 2) (0 3)) ((1 6)) 1) (4 3 ((1 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 2) (1 3)) ((0 6)) 1) (4 4 ((1 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 1)) ((0 6)) 1) (4 3 ((0 1) (0 5)) ((0 6)) 1) (4 3 ((0 1) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 4)) ((0 6)) 1) (4 3 ((0 1) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (1 4)) ((1 6)) 1) (4 3 ((0 1) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 1) (0 3)) ((0 6)) 1) (4 3 ((0 1) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 1) (1 3)) ((1 6)) 1) (4 3 ((0 1) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 1) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 1) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 2)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 2) (0 4)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 2) (1 4)) ((1 6)) 1) (4 3 ((0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 3)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (1 3)) ((1 6)) 1) (4 3 ((0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (1 2)) ((1 6)) 1) (4 3 ((0 1) (1 2) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (1 5)) ((0 6)) 1) (4 3 ((0 1) (1 2) (0 4)) ((1 6)) 1) (4 3 ((0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 4)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 1) (1 2) (0 3)) ((1 6)) 1) (4 3 ((0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (1 3)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((1 1)) ((1 6)) 1) (4 3 ((1 1) (0 5)) ((1 6)) 1) (4 4 ((1 1) (1 5)) ((0 6)) 1) (4 3 ((1 1) (0 4)) ((1 6)) 1) (4 3 ((1 1) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (1 4)) ((0 6)) 1) (4 4 ((1 1) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 1) (0 3)) ((1 6)) 1) (4 3 ((1 1) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 1) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 3)) ((0 6)) 1) (4 4 ((1 1) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((1 1) (0 2)) ((1 6)) 1) (4 3 ((1 1) (0 2) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (1 5)) ((0 6)) 1) (4 3 ((1 1) (0 2) (0 4)) ((1 6)) 1) (4 3 ((1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 4)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 1) (0 2) (0 3)) ((1 6)) 1) (4 3 ((1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (1 3)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (1 2)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 2) (0 4)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 2) (1 4)) ((1 6)) 1) (4 4 ((1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 3)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (4 4 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (1 3)) ((1 6)) 1) (4 4 ((1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (4 5 ((1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (4 4 ((1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (4 4 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (4 5 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0)) ((0 6)) 1) (4 3 ((0 0) (0 5)) ((0 6)) 1) (4 3 ((0 0) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (1 4)) ((1 6)) 1) (4 3 ((0 0) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 3)) ((0 6)) 1) (4 3 ((0 0) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 3)) ((1 6)) 1) (4 3 ((0 0) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 2)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 2) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 2) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 3)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (1 3)) ((1 6)) 1) (4 3 ((0 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (1 2)) ((1 6)) 1) (4 3 ((0 0) (1 2) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 2) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (1 2) (0 3)) ((1 6)) 1) (4 3 ((0 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (1 3)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 3)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (1 3)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 3)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 3)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1) (0 2)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (4 4 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0)) ((1 6)) 1) (4 3 ((1 0) (0 5)) ((1 6)) 1) (4 4 ((1 0) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 4)) ((0 6)) 1) (4 4 ((1 0) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0) (0 3)) ((1 6)) 1) (4 3 ((1 0) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 3)) ((0 6)) 1) (4 4 ((1 0) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 2)) ((1 6)) 1) (4 3 ((1 0) (0 2) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 2) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0) (0 2) (0 3)) ((1 6)) 1) (4 3 ((1 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (1 3)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 2)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 2) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 2) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 3)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (1 3)) ((1 6)) 1) (4 4 ((1 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (4 4 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (4 5 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0) (0 1)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 1) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 3)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 3)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 1) (0 2)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (4 3 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (4 4 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 3)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (1 3)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (4 4 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (4 5 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (4 6 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 () ((1 6)) 1) (5 3 ((0 5)) ((1 6)) 1) (5 4 ((1 5)) ((0 6)) 1) (5 3 ((0 4)) ((1 6)) 1) (5 3 ((0 4) (0 5)) ((1 6)) 1) (5 4 ((0 4) (1 5)) ((0 6)) 1) (5 4 ((1 4)) ((0 6)) 1) (5 4 ((1 4) (0 5)) ((0 6)) 1) (5 4 ((1 4) (1 5)) ((1 6)) 1) (5 3 ((0 3)) ((1 6)) 1) (5 3 ((0 3) (0 5)) ((1 6)) 1) (5 4 ((0 3) (1 5)) ((0 6)) 1) (5 3 ((0 3) (0 4)) ((1 6)) 1) (5 3 ((0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 3) (1 4)) ((0 6)) 1) (5 4 ((0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 3)) ((0 6)) 1) (5 4 ((1 3) (0 5)) ((0 6)) 1) (5 4 ((1 3) (1 5)) ((1 6)) 1) (5 4 ((1 3) (0 4)) ((0 6)) 1) (5 4 ((1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 3) (1 4)) ((1 6)) 1) (5 4 ((1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 ((0 2)) ((1 6)) 1) (5 3 ((0 2) (0 5)) ((1 6)) 1) (5 4 ((0 2) (1 5)) ((0 6)) 1) (5 3 ((0 2) (0 4)) ((1 6)) 1) (5 3 ((0 2) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 2) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 2) (1 4)) ((0 6)) 1) (5 4 ((0 2) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 2) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 2) (0 3)) ((1 6)) 1) (5 3 ((0 2) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 2) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 2) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 2) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 2) (1 3)) ((0 6)) 1) (5 4 ((0 2) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 2) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 2) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 2) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 2)) ((0 6)) 1) (5 4 ((1 2) (0 5)) ((0 6)) 1) (5 4 ((1 2) (1 5)) ((1 6)) 1) (5 4 ((1 2) (0 4)) ((0 6)) 1) (5 4 ((1 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 2) (1 4)) ((1 6)) 1) (5 4 ((1 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 2) (0 3)) ((0 6)) 1) (5 4 ((1 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 2) (1 3)) ((1 6)) 1) (5 4 ((1 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 1)) ((1 6)) 1) (5 3 ((0 1) (0 5)) ((1 6)) 1) (5 4 ((0 1) (1 5)) ((0 6)) 1) (5 3 ((0 1) (0 4)) ((1 6)) 1) (5 3 ((0 1) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (1 4)) ((0 6)) 1) (5 4 ((0 1) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 1) (0 3)) ((1 6)) 1) (5 3 ((0 1) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 1) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 3)) ((0 6)) 1) (5 4 ((0 1) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 ((0 1) (0 2)) ((1 6)) 1) (5 3 ((0 1) (0 2) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (1 5)) ((0 6)) 1) (5 3 ((0 1) (0 2) (0 4)) ((1 6)) 1) (5 3 ((0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 4)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 1) (0 2) (0 3)) ((1 6)) 1) (5 3 ((0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (1 3)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (1 2)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 2) (0 4)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 2) (1 4)) ((1 6)) 1) (5 4 ((0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 3)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (1 3)) ((1 6)) 1) (5 4 ((0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 1)) ((0 6)) 1) (5 4 ((1 1) (0 5)) ((0 6)) 1) (5 4 ((1 1) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 4)) ((0 6)) 1) (5 4 ((1 1) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (1 4)) ((1 6)) 1) (5 4 ((1 1) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 1) (0 3)) ((0 6)) 1) (5 4 ((1 1) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 1) (1 3)) ((1 6)) 1) (5 4 ((1 1) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 1) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 1) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 2)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 2) (0 4)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 2) (1 4)) ((1 6)) 1) (5 4 ((1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 3)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (1 3)) ((1 6)) 1) (5 4 ((1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (1 2)) ((1 6)) 1) (5 4 ((1 1) (1 2) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (1 5)) ((0 6)) 1) (5 4 ((1 1) (1 2) (0 4)) ((1 6)) 1) (5 4 ((1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 4)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 1) (1 2) (0 3)) ((1 6)) 1) (5 4 ((1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (5 4 ((1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (5 4 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (5 5 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (1 3)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (5 5 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 ((0 0)) ((1 6)) 1) (5 3 ((0 0) (0 5)) ((1 6)) 1) (5 4 ((0 0) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 4)) ((0 6)) 1) (5 4 ((0 0) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 0) (0 3)) ((1 6)) 1) (5 3 ((0 0) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 3)) ((0 6)) 1) (5 4 ((0 0) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 2)) ((1 6)) 1) (5 3 ((0 0) (0 2) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 2) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 0) (0 2) (0 3)) ((1 6)) 1) (5 3 ((0 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (1 3)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 2)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 2) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 2) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 3)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (1 3)) ((1 6)) 1) (5 4 ((0 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 0) (0 1)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 1) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 3)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 3)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 1) (0 2)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (5 3 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 3)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (1 3)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (5 4 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (5 5 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0)) ((0 6)) 1) (5 4 ((1 0) (0 5)) ((0 6)) 1) (5 4 ((1 0) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (1 4)) ((1 6)) 1) (5 4 ((1 0) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 3)) ((0 6)) 1) (5 4 ((1 0) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 3)) ((1 6)) 1) (5 4 ((1 0) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 2)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 2) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 2) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 3)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (1 3)) ((1 6)) 1) (5 4 ((1 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (1 2)) ((1 6)) 1) (5 4 ((1 0) (1 2) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 2) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (1 2) (0 3)) ((1 6)) 1) (5 4 ((1 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (1 3)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (5 5 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 3)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (1 3)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (5 5 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 3)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 3)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1) (0 2)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (5 4 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (5 5 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (5 5 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (5 6 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 () ((0 6)) 1) (6 4 ((0 5)) ((0 6)) 1) (6 4 ((1 5)) ((1 6)) 1) (6 4 ((0 4)) ((0 6)) 1) (6 4 ((0 4) (0 5)) ((0 6)) 1) (6 4 ((0 4) (1 5)) ((1 6)) 1) (6 4 ((1 4)) ((1 6)) 1) (6 4 ((1 4) (0 5)) ((1 6)) 1) (6 5 ((1 4) (1 5)) ((0 6)) 1) (6 4 ((0 3)) ((0 6)) 1) (6 4 ((0 3) (0 5)) ((0 6)) 1) (6 4 ((0 3) (1 5)) ((1 6)) 1) (6 4 ((0 3) (0 4)) ((0 6)) 1) (6 4 ((0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 3) (1 4)) ((1 6)) 1) (6 4 ((0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((1 3)) ((1 6)) 1) (6 4 ((1 3) (0 5)) ((1 6)) 1) (6 5 ((1 3) (1 5)) ((0 6)) 1) (6 4 ((1 3) (0 4)) ((1 6)) 1) (6 4 ((1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 3) (1 4)) ((0 6)) 1) (6 5 ((1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 2)) ((0 6)) 1) (6 4 ((0 2) (0 5)) ((0 6)) 1) (6 4 ((0 2) (1 5)) ((1 6)) 1) (6 4 ((0 2) (0 4)) ((0 6)) 1) (6 4 ((0 2) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 2) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 2) (1 4)) ((1 6)) 1) (6 4 ((0 2) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 2) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 2) (0 3)) ((0 6)) 1) (6 4 ((0 2) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 2) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 2) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 2) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 2) (1 3)) ((1 6)) 1) (6 4 ((0 2) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 2) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 2) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 2) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 2)) ((1 6)) 1) (6 4 ((1 2) (0 5)) ((1 6)) 1) (6 5 ((1 2) (1 5)) ((0 6)) 1) (6 4 ((1 2) (0 4)) ((1 6)) 1) (6 4 ((1 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 2) (1 4)) ((0 6)) 1) (6 5 ((1 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 2) (0 3)) ((1 6)) 1) (6 4 ((1 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 2) (1 3)) ((0 6)) 1) (6 5 ((1 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 1)) ((0 6)) 1) (6 4 ((0 1) (0 5)) ((0 6)) 1) (6 4 ((0 1) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 4)) ((0 6)) 1) (6 4 ((0 1) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (1 4)) ((1 6)) 1) (6 4 ((0 1) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 1) (0 3)) ((0 6)) 1) (6 4 ((0 1) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 1) (1 3)) ((1 6)) 1) (6 4 ((0 1) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 1) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 1) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 2)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 2) (0 4)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 2) (1 4)) ((1 6)) 1) (6 4 ((0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 3)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (1 3)) ((1 6)) 1) (6 4 ((0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (1 2)) ((1 6)) 1) (6 4 ((0 1) (1 2) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (1 5)) ((0 6)) 1) (6 4 ((0 1) (1 2) (0 4)) ((1 6)) 1) (6 4 ((0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 4)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 1) (1 2) (0 3)) ((1 6)) 1) (6 4 ((0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (1 3)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((1 1)) ((1 6)) 1) (6 4 ((1 1) (0 5)) ((1 6)) 1) (6 5 ((1 1) (1 5)) ((0 6)) 1) (6 4 ((1 1) (0 4)) ((1 6)) 1) (6 4 ((1 1) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (1 4)) ((0 6)) 1) (6 5 ((1 1) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 1) (0 3)) ((1 6)) 1) (6 4 ((1 1) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 1) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 3)) ((0 6)) 1) (6 5 ((1 1) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((1 1) (0 2)) ((1 6)) 1) (6 4 ((1 1) (0 2) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (1 5)) ((0 6)) 1) (6 4 ((1 1) (0 2) (0 4)) ((1 6)) 1) (6 4 ((1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 4)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 1) (0 2) (0 3)) ((1 6)) 1) (6 4 ((1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (1 3)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (1 2)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 2) (0 4)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 2) (1 4)) ((1 6)) 1) (6 5 ((1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 3)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (6 5 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (1 3)) ((1 6)) 1) (6 5 ((1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (6 6 ((1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (6 5 ((1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (6 5 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (6 6 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0)) ((0 6)) 1) (6 4 ((0 0) (0 5)) ((0 6)) 1) (6 4 ((0 0) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (1 4)) ((1 6)) 1) (6 4 ((0 0) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 3)) ((0 6)) 1) (6 4 ((0 0) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 3)) ((1 6)) 1) (6 4 ((0 0) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 2)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 2) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 2) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 3)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (1 3)) ((1 6)) 1) (6 4 ((0 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (1 2)) ((1 6)) 1) (6 4 ((0 0) (1 2) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 2) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (1 2) (0 3)) ((1 6)) 1) (6 4 ((0 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (1 3)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 3)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (1 3)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 3)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 3)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1) (0 2)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (6 5 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0)) ((1 6)) 1) (6 4 ((1 0) (0 5)) ((1 6)) 1) (6 5 ((1 0) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 4)) ((0 6)) 1) (6 5 ((1 0) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0) (0 3)) ((1 6)) 1) (6 4 ((1 0) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 3)) ((0 6)) 1) (6 5 ((1 0) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 2)) ((1 6)) 1) (6 4 ((1 0) (0 2) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 2) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0) (0 2) (0 3)) ((1 6)) 1) (6 4 ((1 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (1 3)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 2)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 2) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 2) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 3)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (1 3)) ((1 6)) 1) (6 5 ((1 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (6 5 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (6 6 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0) (0 1)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 1) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 3)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 3)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 1) (0 2)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (6 4 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (6 5 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 3)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (1 3)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (6 5 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (6 6 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (6 7 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 () ((1 6)) 1) (7 4 ((0 5)) ((1 6)) 1) (7 5 ((1 5)) ((0 6)) 1) (7 4 ((0 4)) ((1 6)) 1) (7 4 ((0 4) (0 5)) ((1 6)) 1) (7 5 ((0 4) (1 5)) ((0 6)) 1) (7 5 ((1 4)) ((0 6)) 1) (7 5 ((1 4) (0 5)) ((0 6)) 1) (7 5 ((1 4) (1 5)) ((1 6)) 1) (7 4 ((0 3)) ((1 6)) 1) (7 4 ((0 3) (0 5)) ((1 6)) 1) (7 5 ((0 3) (1 5)) ((0 6)) 1) (7 4 ((0 3) (0 4)) ((1 6)) 1) (7 4 ((0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 3) (1 4)) ((0 6)) 1) (7 5 ((0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 3)) ((0 6)) 1) (7 5 ((1 3) (0 5)) ((0 6)) 1) (7 5 ((1 3) (1 5)) ((1 6)) 1) (7 5 ((1 3) (0 4)) ((0 6)) 1) (7 5 ((1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 3) (1 4)) ((1 6)) 1) (7 5 ((1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 ((0 2)) ((1 6)) 1) (7 4 ((0 2) (0 5)) ((1 6)) 1) (7 5 ((0 2) (1 5)) ((0 6)) 1) (7 4 ((0 2) (0 4)) ((1 6)) 1) (7 4 ((0 2) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 2) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 2) (1 4)) ((0 6)) 1) (7 5 ((0 2) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 2) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 2) (0 3)) ((1 6)) 1) (7 4 ((0 2) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 2) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 2) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 2) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 2) (1 3)) ((0 6)) 1) (7 5 ((0 2) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 2) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 2) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 2) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 2)) ((0 6)) 1) (7 5 ((1 2) (0 5)) ((0 6)) 1) (7 5 ((1 2) (1 5)) ((1 6)) 1) (7 5 ((1 2) (0 4)) ((0 6)) 1) (7 5 ((1 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 2) (1 4)) ((1 6)) 1) (7 5 ((1 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 2) (0 3)) ((0 6)) 1) (7 5 ((1 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 2) (1 3)) ((1 6)) 1) (7 5 ((1 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 1)) ((1 6)) 1) (7 4 ((0 1) (0 5)) ((1 6)) 1) (7 5 ((0 1) (1 5)) ((0 6)) 1) (7 4 ((0 1) (0 4)) ((1 6)) 1) (7 4 ((0 1) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (1 4)) ((0 6)) 1) (7 5 ((0 1) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 1) (0 3)) ((1 6)) 1) (7 4 ((0 1) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 1) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 3)) ((0 6)) 1) (7 5 ((0 1) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 ((0 1) (0 2)) ((1 6)) 1) (7 4 ((0 1) (0 2) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (1 5)) ((0 6)) 1) (7 4 ((0 1) (0 2) (0 4)) ((1 6)) 1) (7 4 ((0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 4)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 1) (0 2) (0 3)) ((1 6)) 1) (7 4 ((0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (1 3)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (1 2)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 2) (0 4)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 2) (1 4)) ((1 6)) 1) (7 5 ((0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 3)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (1 3)) ((1 6)) 1) (7 5 ((0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 1)) ((0 6)) 1) (7 5 ((1 1) (0 5)) ((0 6)) 1) (7 5 ((1 1) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 4)) ((0 6)) 1) (7 5 ((1 1) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (1 4)) ((1 6)) 1) (7 5 ((1 1) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 1) (0 3)) ((0 6)) 1) (7 5 ((1 1) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 1) (1 3)) ((1 6)) 1) (7 5 ((1 1) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 1) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 1) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 2)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 2) (0 4)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 2) (1 4)) ((1 6)) 1) (7 5 ((1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 3)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (1 3)) ((1 6)) 1) (7 5 ((1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (1 2)) ((1 6)) 1) (7 5 ((1 1) (1 2) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (1 5)) ((0 6)) 1) (7 5 ((1 1) (1 2) (0 4)) ((1 6)) 1) (7 5 ((1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 4)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 1) (1 2) (0 3)) ((1 6)) 1) (7 5 ((1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (7 5 ((1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (7 5 ((1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (7 6 ((1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (1 3)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (7 6 ((1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 ((0 0)) ((1 6)) 1) (7 4 ((0 0) (0 5)) ((1 6)) 1) (7 5 ((0 0) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 4)) ((0 6)) 1) (7 5 ((0 0) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 0) (0 3)) ((1 6)) 1) (7 4 ((0 0) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 3)) ((0 6)) 1) (7 5 ((0 0) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 2)) ((1 6)) 1) (7 4 ((0 0) (0 2) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 2) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 2) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 0) (0 2) (0 3)) ((1 6)) 1) (7 4 ((0 0) (0 2) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 2) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (1 3)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 2) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 2)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 2) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 2) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 3)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (1 3)) ((1 6)) 1) (7 5 ((0 0) (1 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((0 0) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (1 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((0 0) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 0) (0 1)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 1) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 3)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 1) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 3)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 1) (0 2)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 3)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (7 4 ((0 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 4)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 3)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((0 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 3)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (1 3)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 3) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 3) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (1 3) (0 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 3) (1 4)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 3)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 4)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 3)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (7 5 ((0 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (7 6 ((0 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((0 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0)) ((0 6)) 1) (7 5 ((1 0) (0 5)) ((0 6)) 1) (7 5 ((1 0) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (1 4)) ((1 6)) 1) (7 5 ((1 0) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 3)) ((0 6)) 1) (7 5 ((1 0) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 3)) ((1 6)) 1) (7 5 ((1 0) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 2)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 2) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 2) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 3)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (1 3)) ((1 6)) 1) (7 5 ((1 0) (0 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (0 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (1 2)) ((1 6)) 1) (7 5 ((1 0) (1 2) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 2) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 2) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (1 2) (0 3)) ((1 6)) 1) (7 5 ((1 0) (1 2) (0 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (0 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 2) (0 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (0 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (1 3)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 3) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 3) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (1 3) (0 4)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 2) (1 3) (1 4)) ((1 6)) 1) (7 6 ((1 0) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 3)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (1 3)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (0 4)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (1 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (0 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 3)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (0 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (0 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 4)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 3)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (0 1) (1 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (1 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (0 4)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (1 4)) ((1 6)) 1) (7 6 ((1 0) (0 1) (1 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (0 1) (1 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 3)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1) (0 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 3)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 3) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 3) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 3) (0 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 3) (1 4)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1) (0 2)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 4) (1 5)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 3)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 3) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 3) (1 5)) ((0 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 3) (0 4)) ((1 6)) 1) (7 5 ((1 0) (1 1) (0 2) (0 3) (0 4) (0 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 3) (0 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 3) (1 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 3) (1 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (0 3) (1 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (0 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (1 4)) ((1 6)) 1) (7 6 ((1 0) (1 1) (0 2) (1 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (0 2) (1 3) (1 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 4)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (0 4)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (0 4) (0 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (0 4) (1 5)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (1 4)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (0 3) (1 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (1 2) (0 3) (1 4) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 3)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 3) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 3) (1 5)) ((0 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 3) (0 4)) ((1 6)) 1) (7 6 ((1 0) (1 1) (1 2) (1 3) (0 4) (0 5)) ((1 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 3) (0 4) (1 5)) ((0 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 3) (1 4)) ((0 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 3) (1 4) (0 5)) ((0 6)) 1) (7 7 ((1 0) (1 1) (1 2) (1 3) (1 4) (1 5)) ((1 6)) 1) (2 1 ((255 6)) () 1) (2 2 () () -1)))))
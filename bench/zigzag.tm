@@ -0,0 +1 @@
+((zigzag 1 (0 1 ((0 2 () () -1) (2 3 ((2 0)) ((1 1)) 1) (2 2 () () 1) (3 3 ((0 0)) ((1 0) (1 1)) 1) (3 4 ((1 0)) ((0 0) (1 1)) 1) (3 1 ((2 0)) ((2 1)) 0) (4 4 ((1 1)) () 1) (4 5 () ((1 1)) -1) (5 5 ((1 1)) () -1) (5 2 () ((1 1)) 1)))))